@@ -3,85 +3,162 @@
 #include <cstring>
 #include <iostream>
 
+#include <climits>
+
 #include <fcntl.h>
+#include <linux/futex.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
 
 namespace urf {
 namespace common {
 namespace containers {
 
-SharedObject::SharedObject(const std::string& name, uint32_t fileSize) :
-    filename_("/tmp/"+name+".sobj"),
+namespace {
+
+void prefault(void* mapping, size_t length) {
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(mapping, length, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    // Reads only, the segment may already be in use by other processes
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    volatile const char* page = reinterpret_cast<volatile const char*>(mapping);
+    for (size_t i = 0; i < length; i += pageSize) {
+        (void)page[i];
+    }
+}
+
+}  // namespace
+
+SharedObject::SharedObject(const std::string& name, uint32_t fileSize, const Options& options) :
+    filename_(options.backing == Backing::PosixShm ? "/"+name+".sobj" : "/tmp/"+name+".sobj"),
     stringStart_(),
     filesize_(fileSize),
     fd_(0),
-    mmapMutex_(),
+    mmapHeader_(),
     completeMmap_() {
-        fd_ = ::open(filename_.c_str(), O_RDWR | O_NONBLOCK, 0666);
+        auto openSegment = [this, &options](int flags) {
+            if (options.backing == Backing::PosixShm) {
+                return ::shm_open(filename_.c_str(), flags & ~O_NONBLOCK, 0666);
+            }
+            return ::open(filename_.c_str(), flags, 0666);
+        };
+
+        fd_ = openSegment(O_RDWR | O_NONBLOCK);
 
         bool created = false;
         if (fd_ == -1) {
-            fd_ = ::open(filename_.c_str(), O_RDWR |  O_CREAT | O_TRUNC | O_NONBLOCK, 0666);
+            fd_ = openSegment(O_RDWR |  O_CREAT | O_TRUNC | O_NONBLOCK);
 
-            if (ftruncate(fd_, filesize_ + sizeof(mmap_mutex_t)) == -1) {
+            if (ftruncate(fd_, filesize_ + sizeof(mmap_header_t)) == -1) {
                 throw std::runtime_error(std::strerror(errno));
             }
             created = true;
+        } else {
+            // Mapping past the end of a smaller segment would fault on access
+            struct stat status;
+            if ((fstat(fd_, &status) == 0) &&
+                (static_cast<uint64_t>(status.st_size) < filesize_ + sizeof(mmap_header_t))) {
+                ::close(fd_);
+                throw std::runtime_error("Shared object " + name + " exists with a smaller size");
+            }
         }
 
-        completeMmap_ = mmap(NULL, filesize_ + sizeof(mmap_mutex_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
-        mmapMutex_ = reinterpret_cast<mmap_mutex_t*>(completeMmap_);
-        stringStart_ = reinterpret_cast<char*>(completeMmap_) + sizeof(mmap_mutex_t);
+        const size_t mappingSize = filesize_ + sizeof(mmap_header_t);
+        // MAP_POPULATE would fault in small pages before the huge page hint is given: with huge
+        // pages the mapping is populated after madvise instead
+        bool populateOnMap = options.prefault && !options.hugePages;
+        int mmapFlags = MAP_SHARED | (populateOnMap ? MAP_POPULATE : 0);
+        completeMmap_ = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, mmapFlags, fd_, 0);
+        if (completeMmap_ == MAP_FAILED) {
+            int error = errno;
+            ::close(fd_);
+            throw std::runtime_error(std::strerror(error));
+        }
+
+        if (options.hugePages) {
+            // Only a hint: it fails where transparent huge pages are disabled for the backing
+            madvise(completeMmap_, mappingSize, MADV_HUGEPAGE);
+            if (options.prefault) {
+                prefault(completeMmap_, mappingSize);
+            }
+        }
+        if (options.lockMemory && (mlock(completeMmap_, mappingSize) == -1)) {
+            int error = errno;
+            munmap(completeMmap_, mappingSize);
+            ::close(fd_);
+            throw std::runtime_error(std::string("Could not lock shared memory: ") +
+                                     std::strerror(error));
+        }
+
+        mmapHeader_ = reinterpret_cast<mmap_header_t*>(completeMmap_);
+        stringStart_ = reinterpret_cast<char*>(completeMmap_) + sizeof(mmap_header_t);
 
-        if (pthread_mutex_lock(&mmapMutex_->ipc_mutex) == -1) {
+        if (pthread_mutex_lock(&mmapHeader_->ipc_mutex) == -1) {
             created = true;
         } else {
-            pthread_mutex_unlock(&mmapMutex_->ipc_mutex);
+            pthread_mutex_unlock(&mmapHeader_->ipc_mutex);
         }
 
         if (created) {
-            std::memset(completeMmap_, 0, filesize_ + sizeof(mmap_mutex_t));
+            std::memset(completeMmap_, 0, filesize_ + sizeof(mmap_header_t));
 
             pthread_mutexattr_t mutex_attr;
             pthread_mutexattr_init(&mutex_attr);
             pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
-            pthread_mutex_init(&mmapMutex_->ipc_mutex, &mutex_attr);
+            pthread_mutex_init(&mmapHeader_->ipc_mutex, &mutex_attr);
         }
 }
 
 SharedObject::~SharedObject() {
     unlock();
+    munmap(completeMmap_, filesize_ + sizeof(mmap_header_t));
     ::close(fd_);
 }
 
-bool SharedObject::write(const std::string& bytes, uint32_t offset) {
-    if (bytes.length() + offset > filesize_) {
-        return false;
+void SharedObject::notifyWaiters() {
+    // The syscall is only paid when some process is actually waiting
+    if (mmapHeader_->waiters.load(std::memory_order_seq_cst) > 0) {
+        syscall(SYS_futex, &mmapHeader_->sequence, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
     }
-
-    std::memset(stringStart_+offset+bytes.length(), 0, filesize_-offset-bytes.length());
-    std::memcpy(stringStart_+offset, bytes.c_str(), bytes.length());
-    return true;
 }
 
-std::string SharedObject::read(uint32_t length) {
-    if (length > filesize_) {
-        return std::string();
-    }
+bool SharedObject::waitForUpdate(uint32_t version, const std::chrono::milliseconds& timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        mmapHeader_->waiters.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t sequence = mmapHeader_->sequence.load(std::memory_order_seq_cst);
+        if (((sequence & 1) == 0) && (sequence != version)) {
+            mmapHeader_->waiters.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::nanoseconds(0)) {
+            mmapHeader_->waiters.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
 
-    if (length == 0) {
-        return std::string(stringStart_);
+        // The kernel only puts us to sleep if the sequence still has the observed value
+        auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+        struct timespec relative;
+        relative.tv_sec = nanos / 1000000000;
+        relative.tv_nsec = nanos % 1000000000;
+        syscall(SYS_futex, &mmapHeader_->sequence, FUTEX_WAIT, sequence, &relative, NULL, 0);
+        mmapHeader_->waiters.fetch_sub(1, std::memory_order_relaxed);
     }
-    return std::string(stringStart_, length);
 }
 
 bool SharedObject::lock() {
-    return pthread_mutex_lock(&mmapMutex_->ipc_mutex) != -1;
+    return pthread_mutex_lock(&mmapHeader_->ipc_mutex) != -1;
 }
 
 bool SharedObject::unlock() {
-    return pthread_mutex_unlock(&mmapMutex_->ipc_mutex) != -1;
+    return pthread_mutex_unlock(&mmapHeader_->ipc_mutex) != -1;
 }
 
 }  // namespace containers
@@ -0,0 +1,63 @@
+#include "urf/common/containers/QueueSelector.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+QueueSelector::QueueSelector()
+    : signal_(std::make_shared<QueueSignal>())
+    , sources_()
+    , next_(0)
+    , notifySent_(false) { }
+
+QueueSelector::~QueueSelector() {
+    for (auto& source : sources_) {
+        source.detach();
+    }
+}
+
+size_t QueueSelector::size() const {
+    return sources_.size();
+}
+
+std::optional<size_t> QueueSelector::select() {
+    return selectUntil(std::nullopt);
+}
+
+std::optional<size_t> QueueSelector::select(const std::chrono::milliseconds& timeout) {
+    return selectUntil(std::chrono::steady_clock::now() + timeout);
+}
+
+void QueueSelector::notifyAll() {
+    notifySent_ = true;
+    signal_->notify();
+}
+
+std::optional<size_t> QueueSelector::selectUntil(
+    const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    notifySent_ = false;
+    while (true) {
+        // The generation is read before scanning, a push racing with the scan bumps it and
+        // makes the following wait return immediately
+        uint64_t generation = signal_->generation();
+        if (notifySent_) {
+            return std::nullopt;
+        }
+
+        for (size_t i = 0; i < sources_.size(); i++) {
+            size_t index = (next_ + i) % sources_.size();
+            if (sources_[index].ready()) {
+                next_ = index + 1;
+                return index;
+            }
+        }
+
+        if (!signal_->waitUntil(generation, deadline)) {
+            return std::nullopt;
+        }
+    }
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
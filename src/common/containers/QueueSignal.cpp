@@ -0,0 +1,38 @@
+#include "urf/common/containers/QueueSignal.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+QueueSignal::QueueSignal()
+    : mtx_()
+    , cv_()
+    , generation_(0) { }
+
+void QueueSignal::notify() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    generation_++;
+    cv_.notify_all();
+}
+
+uint64_t QueueSignal::generation() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    return generation_;
+}
+
+bool QueueSignal::waitUntil(uint64_t generation,
+                            const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (!deadline) {
+        cv_.wait(lock, [this, generation]() { return generation_ != generation; });
+        return true;
+    }
+
+    return cv_.wait_until(lock, *deadline, [this, generation]() {
+        return generation_ != generation;
+    });
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
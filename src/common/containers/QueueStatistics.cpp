@@ -0,0 +1,64 @@
+#include "urf/common/containers/QueueStatistics.hpp"
+
+#include <algorithm>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+QueueStatistics::QueueStatistics()
+    : pushTimes_()
+    , start_(std::chrono::steady_clock::now())
+    , peakDepth_(0)
+    , pushes_(0)
+    , pops_(0)
+    , waitTime_() { }
+
+void QueueStatistics::onPush(size_t depth) {
+    pushTimes_.push_back(std::chrono::steady_clock::now());
+    peakDepth_ = std::max(peakDepth_, depth);
+    pushes_++;
+}
+
+void QueueStatistics::onPop(size_t) {
+    if (!pushTimes_.empty()) {
+        waitTime_.record(std::chrono::steady_clock::now() - pushTimes_.front());
+        pushTimes_.pop_front();
+    }
+    pops_++;
+}
+
+void QueueStatistics::onAssign(size_t depth) {
+    // The elements come from somewhere else, their wait time starts now
+    pushTimes_.assign(depth, std::chrono::steady_clock::now());
+    peakDepth_ = std::max(peakDepth_, depth);
+}
+
+void QueueStatistics::reset(size_t depth) {
+    start_ = std::chrono::steady_clock::now();
+    peakDepth_ = depth;
+    pushes_ = 0;
+    pops_ = 0;
+    waitTime_.reset();
+}
+
+QueueStatisticsSnapshot QueueStatistics::snapshot() const {
+    QueueStatisticsSnapshot snapshot;
+    snapshot.depth = pushTimes_.size();
+    snapshot.peakDepth = peakDepth_;
+    snapshot.pushes = pushes_;
+    snapshot.pops = pops_;
+    snapshot.elapsed = std::chrono::steady_clock::now() - start_;
+    snapshot.waitTime = waitTime_;
+
+    double seconds = std::chrono::duration<double>(snapshot.elapsed).count();
+    if (seconds > 0) {
+        snapshot.pushRate = pushes_ / seconds;
+        snapshot.popRate = pops_ / seconds;
+    }
+    return snapshot;
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,159 @@
+#include "urf/common/containers/SharedBroadcastRing.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+SharedBroadcastRing::SharedBroadcastRing(const std::string& name,
+                                         uint32_t slotSize,
+                                         uint32_t slotsCount)
+    : object_(name,
+              static_cast<uint32_t>(sizeof(ring_header_t) +
+                                    static_cast<uint64_t>(slotStride(slotSize)) * slotsCount))
+    , header_()
+    , slotSize_(slotSize)
+    , slotsCount_(slotsCount)
+    , slotStride_(slotStride(slotSize))
+    , cursor_(0)
+    , overruns_(0) {
+    if (slotsCount == 0) {
+        throw std::invalid_argument("A broadcast ring needs at least one slot");
+    }
+
+    header_ = reinterpret_cast<ring_header_t*>(const_cast<char*>(object_.data()));
+
+    object_.lock();
+    if (header_->slotsCount == 0) {
+        header_->slotSize = slotSize;
+        header_->slotsCount = slotsCount;
+    }
+    object_.unlock();
+
+    if ((header_->slotSize != slotSize) || (header_->slotsCount != slotsCount)) {
+        throw std::runtime_error("Broadcast ring " + name + " exists with a different geometry");
+    }
+
+    cursor_ = header_->writeIndex.load(std::memory_order_acquire);
+}
+
+bool SharedBroadcastRing::push(const std::string& frame) {
+    return push(frame.data(), static_cast<uint32_t>(frame.length()));
+}
+
+bool SharedBroadcastRing::push(const void* frame, uint32_t length) {
+    if (length > slotSize_) {
+        return false;
+    }
+
+    uint64_t index = header_->writeIndex.load(std::memory_order_relaxed);
+    slot_header_t* target = slot(index);
+
+    // The SharedObject write only wraps the slot update to wake up readers in waitForUpdate
+    object_.beginWrite();
+    target->sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(reinterpret_cast<char*>(target) + sizeof(slot_header_t), frame, length);
+    target->length = length;
+
+    target->sequence.store(2 * index + 2, std::memory_order_release);
+    header_->writeIndex.store(index + 1, std::memory_order_release);
+    object_.endWrite(object_.capacity());
+    return true;
+}
+
+std::optional<std::string> SharedBroadcastRing::read() {
+    while (true) {
+        uint64_t writeIndex = header_->writeIndex.load(std::memory_order_acquire);
+        if (cursor_ >= writeIndex) {
+            return std::nullopt;
+        }
+
+        if (writeIndex - cursor_ > slotsCount_) {
+            overruns_ += writeIndex - slotsCount_ - cursor_;
+            cursor_ = writeIndex - slotsCount_;
+        }
+
+        slot_header_t* source = slot(cursor_);
+        uint64_t sequence = source->sequence.load(std::memory_order_acquire);
+        if (sequence == 2 * cursor_ + 2) {
+            uint32_t length = std::min(source->length, slotSize_);
+            std::string frame(reinterpret_cast<const char*>(source) + sizeof(slot_header_t),
+                              length);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (source->sequence.load(std::memory_order_relaxed) == sequence) {
+                cursor_++;
+                return frame;
+            }
+        }
+
+        // The writer is overwriting the slot: the frame is lost, move on to the next one
+        overruns_++;
+        cursor_++;
+    }
+}
+
+std::optional<std::string> SharedBroadcastRing::read(const std::chrono::milliseconds& timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        uint32_t version = object_.version();
+        auto frame = read();
+        if (frame) {
+            return frame;
+        }
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if ((remaining.count() <= 0) || !object_.waitForUpdate(version, remaining)) {
+            return read();
+        }
+    }
+}
+
+uint64_t SharedBroadcastRing::overruns() const {
+    return overruns_;
+}
+
+void SharedBroadcastRing::seekToLatest() {
+    cursor_ = header_->writeIndex.load(std::memory_order_acquire);
+}
+
+void SharedBroadcastRing::seekToOldest() {
+    uint64_t writeIndex = header_->writeIndex.load(std::memory_order_acquire);
+    cursor_ = writeIndex > slotsCount_ ? writeIndex - slotsCount_ : 0;
+}
+
+uint32_t SharedBroadcastRing::slotSize() const {
+    return slotSize_;
+}
+
+uint32_t SharedBroadcastRing::slotsCount() const {
+    return slotsCount_;
+}
+
+bool SharedBroadcastRing::lock() {
+    return object_.lock();
+}
+
+bool SharedBroadcastRing::unlock() {
+    return object_.unlock();
+}
+
+uint32_t SharedBroadcastRing::slotStride(uint32_t slotSize) {
+    // Keeps every slot header 8 bytes aligned
+    return static_cast<uint32_t>((sizeof(slot_header_t) + slotSize + 7) & ~uint64_t(7));
+}
+
+SharedBroadcastRing::slot_header_t* SharedBroadcastRing::slot(uint64_t index) const {
+    char* slots = reinterpret_cast<char*>(header_) + sizeof(ring_header_t);
+    return reinterpret_cast<slot_header_t*>(slots +
+                                            static_cast<uint64_t>(index % slotsCount_) *
+                                                slotStride_);
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,208 @@
+#include "urf/common/containers/SharedHeap.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+namespace {
+
+constexpr uint32_t ArenaMagic = 0x48524655; // "UFRH"
+constexpr uint64_t AllocatedMark = ~static_cast<uint64_t>(0);
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+void SharedArena::initialize(uint64_t size) {
+    uint64_t firstBlock = alignUp(sizeof(SharedArena), Alignment);
+    if (size < firstBlock + 2 * sizeof(Block)) {
+        throw std::invalid_argument("The shared segment is too small to host a heap");
+    }
+
+    magic_ = ArenaMagic;
+    reserved_ = 0;
+    size_ = size & ~static_cast<uint64_t>(Alignment - 1);
+    freeList_ = firstBlock;
+    freeBytes_ = size_ - firstBlock;
+    root_ = 0;
+    padding_ = 0;
+
+    Block* first = block(firstBlock);
+    first->size = freeBytes_;
+    first->nextFree = 0;
+}
+
+bool SharedArena::initialized() const {
+    return magic_ == ArenaMagic;
+}
+
+void* SharedArena::allocate(size_t bytes) {
+    // Also keeps the size computation below from wrapping around
+    if (bytes > size_) {
+        return nullptr;
+    }
+
+    uint64_t needed = alignUp(std::max<uint64_t>(bytes, 1), Alignment) + sizeof(Block);
+
+    uint64_t previous = 0;
+    uint64_t current = freeList_;
+    while ((current != 0) && (block(current)->size < needed)) {
+        previous = current;
+        current = block(current)->nextFree;
+    }
+
+    if (current == 0) {
+        return nullptr;
+    }
+
+    Block* found = block(current);
+    uint64_t next = found->nextFree;
+    // Splits only when the remainder can still hold a minimum block
+    if (found->size >= needed + sizeof(Block) + Alignment) {
+        uint64_t rest = current + needed;
+        block(rest)->size = found->size - needed;
+        block(rest)->nextFree = next;
+        found->size = needed;
+        next = rest;
+    }
+
+    if (previous == 0) {
+        freeList_ = next;
+    } else {
+        block(previous)->nextFree = next;
+    }
+
+    found->nextFree = AllocatedMark;
+    freeBytes_ -= found->size;
+    return reinterpret_cast<char*>(found) + sizeof(Block);
+}
+
+void SharedArena::deallocate(void* pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+
+    uint64_t offset = offsetOf(pointer) - sizeof(Block);
+    Block* released = block(offset);
+    if (released->nextFree != AllocatedMark) {
+        throw std::invalid_argument("The pointer is not an allocated block of this heap");
+    }
+
+    uint64_t previous = 0;
+    uint64_t current = freeList_;
+    while ((current != 0) && (current < offset)) {
+        previous = current;
+        current = block(current)->nextFree;
+    }
+
+    freeBytes_ += released->size;
+    released->nextFree = current;
+    if ((current != 0) && (offset + released->size == current)) {
+        released->size += block(current)->size;
+        released->nextFree = block(current)->nextFree;
+    }
+
+    if (previous == 0) {
+        freeList_ = offset;
+    } else if (previous + block(previous)->size == offset) {
+        block(previous)->size += released->size;
+        block(previous)->nextFree = released->nextFree;
+    } else {
+        block(previous)->nextFree = offset;
+    }
+}
+
+uint64_t SharedArena::offsetOf(const void* pointer) const {
+    return static_cast<uint64_t>(reinterpret_cast<const char*>(pointer) -
+                                 reinterpret_cast<const char*>(this));
+}
+
+void* SharedArena::at(uint64_t offset) const {
+    return const_cast<char*>(reinterpret_cast<const char*>(this)) + offset;
+}
+
+uint64_t SharedArena::freeBytes() const {
+    return freeBytes_;
+}
+
+uint64_t SharedArena::size() const {
+    return size_;
+}
+
+void* SharedArena::root() const {
+    return root_ == 0 ? nullptr : at(root_);
+}
+
+void SharedArena::setRoot(const void* pointer) {
+    root_ = pointer == nullptr ? 0 : offsetOf(pointer);
+}
+
+SharedArena::Block* SharedArena::block(uint64_t offset) const {
+    return static_cast<Block*>(at(offset));
+}
+
+SharedHeap::SharedHeap(const std::string& name, uint32_t size)
+    : object_(name, size + static_cast<uint32_t>(SharedArena::Alignment))
+    , arena_() {
+    // The mapping is page aligned and the payload starts at a fixed offset in it, so every
+    // process computes the same padding
+    char* payload = const_cast<char*>(object_.data());
+    uint64_t padding = alignUp(reinterpret_cast<uintptr_t>(payload), SharedArena::Alignment) -
+                       reinterpret_cast<uintptr_t>(payload);
+    arena_ = reinterpret_cast<SharedArena*>(payload + padding);
+
+    object_.lock();
+    if (!arena_->initialized()) {
+        arena_->initialize(object_.capacity() - padding);
+    }
+    object_.unlock();
+}
+
+void SharedHeap::reset() {
+    arena_->initialize(arena_->size());
+}
+
+bool SharedHeap::lock() {
+    return object_.lock();
+}
+
+bool SharedHeap::unlock() {
+    return object_.unlock();
+}
+
+void* SharedHeap::allocate(size_t bytes) {
+    return arena_->allocate(bytes);
+}
+
+void SharedHeap::deallocate(void* pointer) {
+    arena_->deallocate(pointer);
+}
+
+void SharedHeap::setRoot(const void* pointer) {
+    arena_->setRoot(pointer);
+}
+
+uint64_t SharedHeap::offsetOf(const void* pointer) const {
+    return arena_->offsetOf(pointer);
+}
+
+void* SharedHeap::at(uint64_t offset) const {
+    return arena_->at(offset);
+}
+
+uint64_t SharedHeap::freeBytes() const {
+    return arena_->freeBytes();
+}
+
+SharedArena* SharedHeap::arena() const {
+    return arena_;
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
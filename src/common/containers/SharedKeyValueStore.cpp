@@ -0,0 +1,292 @@
+#include "urf/common/containers/SharedKeyValueStore.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+SharedKeyValueStore::SharedKeyValueStore(const std::string& name,
+                                         uint32_t capacity,
+                                         uint32_t keySize,
+                                         uint32_t valueSize)
+    : object_(name, segmentSize(capacity, keySize, valueSize))
+    , header_()
+    , capacity_(capacity)
+    , keySize_(keySize)
+    , valueSize_(valueSize)
+    , slotStride_(slotStride(keySize, valueSize)) {
+    header_ = reinterpret_cast<table_header_t*>(const_cast<char*>(object_.data()));
+
+    object_.lock();
+    if (header_->capacity == 0) {
+        header_->capacity = capacity;
+        header_->keySize = keySize;
+        header_->valueSize = valueSize;
+        header_->count = 0;
+    }
+    object_.unlock();
+
+    if ((header_->capacity != capacity) || (header_->keySize != keySize) ||
+        (header_->valueSize != valueSize)) {
+        throw std::runtime_error("Key value store " + name + " exists with a different geometry");
+    }
+}
+
+bool SharedKeyValueStore::set(const std::string& key, const std::string& value) {
+    if ((key.length() > keySize_) || (value.length() > valueSize_)) {
+        return false;
+    }
+
+    uint32_t hash = hashOf(key);
+    object_.lock();
+    bool found = false;
+    auto index = find(key, hash, found);
+    if (!index) {
+        object_.unlock();
+        return false;
+    }
+
+    slot_header_t* target = slot(*index);
+    beginSlotWrite(target);
+    target->state = Used;
+    target->hash = hash;
+    target->keyLength = static_cast<uint32_t>(key.length());
+    target->valueLength = static_cast<uint32_t>(value.length());
+    std::memcpy(keyOf(target), key.data(), key.length());
+    std::memcpy(valueOf(target), value.data(), value.length());
+    endSlotWrite(target);
+
+    if (!found) {
+        header_->count++;
+    }
+    object_.unlock();
+    return true;
+}
+
+std::optional<std::string> SharedKeyValueStore::get(const std::string& key) const {
+    if (key.length() > keySize_) {
+        return std::nullopt;
+    }
+
+    uint32_t hash = hashOf(key);
+    for (uint32_t probe = 0; probe < capacity_; probe++) {
+        slot_header_t* source = slot(probeIndex(hash, probe));
+        while (true) {
+            uint32_t sequence = source->sequence.load(std::memory_order_acquire);
+            if (sequence & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            uint32_t state = source->state;
+            bool match = (state == Used) && matches(source, hash, key);
+            std::optional<std::string> value;
+            if (match) {
+                value = std::string(valueOf(source), std::min(source->valueLength, valueSize_));
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (source->sequence.load(std::memory_order_relaxed) != sequence) {
+                continue;
+            }
+
+            if (match) {
+                return value;
+            }
+            if (state == Empty) {
+                return std::nullopt;
+            }
+            break;
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool SharedKeyValueStore::contains(const std::string& key) const {
+    return get(key).has_value();
+}
+
+bool SharedKeyValueStore::erase(const std::string& key) {
+    if (key.length() > keySize_) {
+        return false;
+    }
+
+    object_.lock();
+    bool found = false;
+    auto index = find(key, hashOf(key), found);
+    if (found) {
+        // Erased slots keep probe chains intact, they are reused by later insertions. A slot
+        // followed by an empty one ends its chain: it becomes empty, and so do the tombstones
+        // before it, which keeps lookups of absent keys short after churn
+        slot_header_t* target = slot(*index);
+        bool endsChain = slot(probeIndex(*index, 1))->state == Empty;
+        beginSlotWrite(target);
+        target->state = endsChain ? Empty : Erased;
+        endSlotWrite(target);
+        if (endsChain) {
+            reclaimTombstones(*index);
+        }
+        header_->count--;
+    }
+    object_.unlock();
+    return found;
+}
+
+void SharedKeyValueStore::clear() {
+    object_.lock();
+    for (uint32_t i = 0; i < capacity_; i++) {
+        slot_header_t* target = slot(i);
+        if (target->state != Empty) {
+            beginSlotWrite(target);
+            target->state = Empty;
+            endSlotWrite(target);
+        }
+    }
+    header_->count = 0;
+    object_.unlock();
+}
+
+size_t SharedKeyValueStore::size() {
+    object_.lock();
+    size_t count = header_->count;
+    object_.unlock();
+    return count;
+}
+
+std::vector<std::string> SharedKeyValueStore::keys() {
+    std::vector<std::string> keys;
+    object_.lock();
+    for (uint32_t i = 0; i < capacity_; i++) {
+        slot_header_t* source = slot(i);
+        if (source->state == Used) {
+            keys.emplace_back(keyOf(source), std::min(source->keyLength, keySize_));
+        }
+    }
+    object_.unlock();
+    return keys;
+}
+
+uint32_t SharedKeyValueStore::capacity() const {
+    return capacity_;
+}
+
+uint32_t SharedKeyValueStore::keySize() const {
+    return keySize_;
+}
+
+uint32_t SharedKeyValueStore::valueSize() const {
+    return valueSize_;
+}
+
+uint32_t SharedKeyValueStore::hashOf(const std::string& key) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint64_t SharedKeyValueStore::slotStride(uint32_t keySize, uint32_t valueSize) {
+    // Keeps every slot header 8 bytes aligned
+    return (sizeof(slot_header_t) + static_cast<uint64_t>(keySize) + valueSize + 7) &
+           ~uint64_t(7);
+}
+
+uint32_t SharedKeyValueStore::segmentSize(uint32_t capacity, uint32_t keySize, uint32_t valueSize) {
+    if ((capacity == 0) || (keySize == 0)) {
+        throw std::invalid_argument("A key value store needs a capacity and a key size");
+    }
+
+    uint64_t size = sizeof(table_header_t) + slotStride(keySize, valueSize) * capacity;
+    if (size > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("The key value store does not fit a shared segment");
+    }
+    return static_cast<uint32_t>(size);
+}
+
+SharedKeyValueStore::slot_header_t* SharedKeyValueStore::slot(uint32_t index) const {
+    char* slots = reinterpret_cast<char*>(header_) + sizeof(table_header_t);
+    return reinterpret_cast<slot_header_t*>(slots + index * slotStride_);
+}
+
+char* SharedKeyValueStore::keyOf(slot_header_t* entry) const {
+    return reinterpret_cast<char*>(entry) + sizeof(slot_header_t);
+}
+
+char* SharedKeyValueStore::valueOf(slot_header_t* entry) const {
+    return keyOf(entry) + keySize_;
+}
+
+bool SharedKeyValueStore::matches(slot_header_t* entry,
+                                  uint32_t hash,
+                                  const std::string& key) const {
+    return (entry->hash == hash) && (entry->keyLength == key.length()) &&
+           (std::memcmp(keyOf(entry), key.data(), key.length()) == 0);
+}
+
+uint32_t SharedKeyValueStore::probeIndex(uint32_t hash, uint32_t probe) const {
+    // Reduced first, so that the sum never wraps around 2^32
+    return static_cast<uint32_t>((static_cast<uint64_t>(hash % capacity_) + probe) % capacity_);
+}
+
+void SharedKeyValueStore::reclaimTombstones(uint32_t index) {
+    for (uint32_t i = 1; i < capacity_; i++) {
+        slot_header_t* previous = slot(probeIndex(index, capacity_ - i));
+        if (previous->state != Erased) {
+            return;
+        }
+
+        beginSlotWrite(previous);
+        previous->state = Empty;
+        endSlotWrite(previous);
+    }
+}
+
+std::optional<uint32_t> SharedKeyValueStore::find(const std::string& key,
+                                                  uint32_t hash,
+                                                  bool& found) const {
+    std::optional<uint32_t> firstErased;
+    for (uint32_t probe = 0; probe < capacity_; probe++) {
+        uint32_t index = probeIndex(hash, probe);
+        slot_header_t* candidate = slot(index);
+        if (candidate->state == Empty) {
+            found = false;
+            return firstErased ? firstErased : index;
+        }
+
+        if ((candidate->state == Used) && matches(candidate, hash, key)) {
+            found = true;
+            return index;
+        }
+
+        if ((candidate->state == Erased) && !firstErased) {
+            firstErased = index;
+        }
+    }
+
+    found = false;
+    return firstErased;
+}
+
+void SharedKeyValueStore::beginSlotWrite(slot_header_t* entry) {
+    entry->sequence.store(entry->sequence.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SharedKeyValueStore::endSlotWrite(slot_header_t* entry) {
+    entry->sequence.store(entry->sequence.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_release);
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,145 @@
+#include "urf/common/containers/SharedObject.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+// Platform independent part of SharedObject, the segment mapping, the IPC lock and the update
+// notification live in the Linux and Windows translation units
+
+namespace urf {
+namespace common {
+namespace containers {
+
+SharedObject::SharedObject(const std::string& name, uint32_t fileSize) :
+    SharedObject(name, fileSize, Options{Backing::File, false, false, false}) { }
+
+bool SharedObject::write(const std::string& bytes, uint32_t offset) {
+    return writeBytes(bytes.data(), static_cast<uint32_t>(bytes.length()), offset);
+}
+
+bool SharedObject::writeBytes(const void* bytes, uint32_t length, uint32_t offset) {
+    if (static_cast<uint64_t>(length) + offset > filesize_) {
+        return false;
+    }
+
+    uint32_t previousLength = size();
+    beginWrite();
+    if (offset > previousLength) {
+        std::memset(stringStart_+previousLength, 0, offset-previousLength);
+    }
+    std::memcpy(stringStart_+offset, bytes, length);
+    endWrite(offset + length);
+    return true;
+}
+
+bool SharedObject::writev(const std::vector<Range>& ranges) {
+    uint32_t length = size();
+    for (const auto& range : ranges) {
+        if (static_cast<uint64_t>(range.length) + range.offset > filesize_) {
+            return false;
+        }
+        length = std::max(length, range.offset + range.length);
+    }
+
+    uint32_t previousLength = size();
+    beginWrite();
+    for (const auto& range : ranges) {
+        if (range.offset > previousLength) {
+            std::memset(stringStart_+previousLength, 0, range.offset-previousLength);
+        }
+        std::memcpy(stringStart_+range.offset, range.bytes, range.length);
+        previousLength = std::max(previousLength, range.offset + range.length);
+    }
+    endWrite(length);
+    return true;
+}
+
+std::string SharedObject::read(uint32_t length) {
+    if (length > filesize_) {
+        return std::string();
+    }
+
+    return copyPayload(length);
+}
+
+std::string SharedObject::snapshot(uint32_t length) {
+    if (length > filesize_) {
+        return std::string();
+    }
+
+    while (true) {
+        uint32_t sequence = mmapHeader_->sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+            // A write is in progress
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::string copy = copyPayload(length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (mmapHeader_->sequence.load(std::memory_order_relaxed) == sequence) {
+            return copy;
+        }
+    }
+}
+
+bool SharedObject::snapshot(void* destination, uint32_t length) {
+    if (length > filesize_) {
+        return false;
+    }
+
+    while (true) {
+        uint32_t sequence = mmapHeader_->sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::memcpy(destination, stringStart_, length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (mmapHeader_->sequence.load(std::memory_order_relaxed) == sequence) {
+            return true;
+        }
+    }
+}
+
+std::string SharedObject::copyPayload(uint32_t length) const {
+    if (length == 0) {
+        return std::string(stringStart_, size());
+    }
+    return std::string(stringStart_, length);
+}
+
+const char* SharedObject::data() const {
+    return stringStart_;
+}
+
+uint32_t SharedObject::size() const {
+    return std::min(mmapHeader_->length.load(std::memory_order_relaxed), filesize_);
+}
+
+uint32_t SharedObject::capacity() const {
+    return filesize_;
+}
+
+char* SharedObject::beginWrite() {
+    mmapHeader_->sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return stringStart_;
+}
+
+void SharedObject::endWrite(uint32_t length) {
+    mmapHeader_->length.store(std::min(length, filesize_), std::memory_order_relaxed);
+    mmapHeader_->sequence.fetch_add(1, std::memory_order_seq_cst);
+    notifyWaiters();
+}
+
+uint32_t SharedObject::version() const {
+    uint32_t sequence = mmapHeader_->sequence.load(std::memory_order_acquire);
+    return sequence & ~1u;
+}
+
+}  // namespace containers
+}  // namespace common
+}  // namespace urf
@@ -0,0 +1,66 @@
+#include "urf/common/containers/SharedString.hpp"
+
+#include <cstring>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+SharedString::SharedString(SharedArena* arena)
+    : chars_(arena) { }
+
+SharedString::SharedString(SharedArena* arena, const std::string& value)
+    : chars_(arena) {
+    assign(value);
+}
+
+size_t SharedString::size() const {
+    return chars_.empty() ? 0 : chars_.size() - 1;
+}
+
+bool SharedString::empty() const {
+    return size() == 0;
+}
+
+const char* SharedString::c_str() const {
+    return chars_.empty() ? "" : chars_.data();
+}
+
+std::string SharedString::str() const {
+    return std::string(c_str(), size());
+}
+
+void SharedString::assign(const std::string& value) {
+    chars_.assign(value.c_str(), value.size() + 1);
+}
+
+void SharedString::append(const std::string& value) {
+    if (value.empty()) {
+        return;
+    }
+
+    size_t length = size();
+    chars_.resize(length + value.size() + 1);
+    std::memcpy(chars_.data() + length, value.c_str(), value.size() + 1);
+}
+
+void SharedString::clear() {
+    chars_.clear();
+}
+
+SharedString& SharedString::operator=(const std::string& value) {
+    assign(value);
+    return *this;
+}
+
+bool SharedString::operator==(const std::string& value) const {
+    return (size() == value.size()) && (value.compare(0, value.size(), c_str(), size()) == 0);
+}
+
+bool SharedString::operator!=(const std::string& value) const {
+    return !(*this == value);
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
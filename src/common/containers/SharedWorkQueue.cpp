@@ -0,0 +1,194 @@
+#include "urf/common/containers/SharedWorkQueue.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+SharedWorkQueue::SharedWorkQueue(const std::string& name, uint32_t recordSize, uint32_t capacity)
+    : object_(name,
+              static_cast<uint32_t>(sizeof(queue_header_t) +
+                                    static_cast<uint64_t>(recordStride(recordSize)) * capacity))
+    , header_()
+    , recordSize_(recordSize)
+    , capacity_(capacity)
+    , recordStride_(recordStride(recordSize)) {
+    if (capacity == 0) {
+        throw std::invalid_argument("A work queue needs a capacity of at least one record");
+    }
+
+    header_ = reinterpret_cast<queue_header_t*>(const_cast<char*>(object_.data()));
+
+    object_.lock();
+    if (header_->capacity == 0) {
+        header_->recordSize = recordSize;
+        header_->capacity = capacity;
+    }
+    object_.unlock();
+
+    if ((header_->recordSize != recordSize) || (header_->capacity != capacity)) {
+        throw std::runtime_error("Work queue " + name + " exists with a different geometry");
+    }
+}
+
+bool SharedWorkQueue::push(const std::string& record) {
+    return pushUntil(record, std::nullopt);
+}
+
+bool SharedWorkQueue::push(const std::string& record, const std::chrono::milliseconds& timeout) {
+    return pushUntil(record, std::chrono::steady_clock::now() + timeout);
+}
+
+std::optional<std::string> SharedWorkQueue::pop() {
+    return popUntil(std::nullopt);
+}
+
+std::optional<std::string> SharedWorkQueue::pop(const std::chrono::milliseconds& timeout) {
+    return popUntil(std::chrono::steady_clock::now() + timeout);
+}
+
+size_t SharedWorkQueue::size() {
+    object_.lock();
+    size_t size = header_->disposed ? 0 : static_cast<size_t>(header_->tail - header_->head);
+    object_.unlock();
+    return size;
+}
+
+void SharedWorkQueue::clear() {
+    object_.lock();
+    if (!header_->disposed) {
+        object_.beginWrite();
+        header_->head = header_->tail;
+        object_.endWrite(object_.capacity());
+    }
+    object_.unlock();
+}
+
+bool SharedWorkQueue::empty() {
+    return size() == 0;
+}
+
+bool SharedWorkQueue::isDisposed() {
+    object_.lock();
+    bool disposed = header_->disposed != 0;
+    object_.unlock();
+    return disposed;
+}
+
+void SharedWorkQueue::dispose() {
+    object_.lock();
+    object_.beginWrite();
+    header_->disposed = 1;
+    object_.endWrite(object_.capacity());
+    object_.unlock();
+}
+
+void SharedWorkQueue::reset() {
+    object_.lock();
+    object_.beginWrite();
+    header_->head = 0;
+    header_->tail = 0;
+    header_->disposed = 0;
+    object_.endWrite(object_.capacity());
+    object_.unlock();
+}
+
+uint32_t SharedWorkQueue::recordSize() const {
+    return recordSize_;
+}
+
+uint32_t SharedWorkQueue::capacity() const {
+    return capacity_;
+}
+
+bool SharedWorkQueue::pushUntil(const std::string& record, const OptionalDeadline& deadline) {
+    if (record.length() > recordSize_) {
+        return false;
+    }
+
+    while (true) {
+        object_.lock();
+        if (header_->disposed) {
+            object_.unlock();
+            return false;
+        }
+
+        if (header_->tail - header_->head < capacity_) {
+            record_header_t* target = recordAt(header_->tail);
+            object_.beginWrite();
+            target->length = static_cast<uint32_t>(record.length());
+            std::memcpy(reinterpret_cast<char*>(target) + sizeof(record_header_t),
+                        record.data(),
+                        record.length());
+            header_->tail++;
+            object_.endWrite(object_.capacity());
+            object_.unlock();
+            return true;
+        }
+
+        // The state only changes under the lock, so the version read here can't miss a pop
+        uint32_t version = object_.version();
+        object_.unlock();
+        if (!waitForUpdate(version, deadline)) {
+            return false;
+        }
+    }
+}
+
+std::optional<std::string> SharedWorkQueue::popUntil(const OptionalDeadline& deadline) {
+    while (true) {
+        object_.lock();
+        if (header_->disposed) {
+            object_.unlock();
+            return std::nullopt;
+        }
+
+        if (header_->tail != header_->head) {
+            record_header_t* source = recordAt(header_->head);
+            std::string elem(reinterpret_cast<const char*>(source) + sizeof(record_header_t),
+                             std::min(source->length, recordSize_));
+            object_.beginWrite();
+            header_->head++;
+            object_.endWrite(object_.capacity());
+            object_.unlock();
+            return elem;
+        }
+
+        uint32_t version = object_.version();
+        object_.unlock();
+        if (!waitForUpdate(version, deadline)) {
+            return std::nullopt;
+        }
+    }
+}
+
+bool SharedWorkQueue::waitForUpdate(uint32_t version, const OptionalDeadline& deadline) {
+    if (!deadline) {
+        while (!object_.waitForUpdate(version, std::chrono::hours(1))) { }
+        return true;
+    }
+
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        *deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0) {
+        return false;
+    }
+    return object_.waitForUpdate(version, remaining);
+}
+
+uint32_t SharedWorkQueue::recordStride(uint32_t recordSize) {
+    return static_cast<uint32_t>((sizeof(record_header_t) + recordSize + 7) & ~uint64_t(7));
+}
+
+SharedWorkQueue::record_header_t* SharedWorkQueue::recordAt(uint64_t index) const {
+    char* records = reinterpret_cast<char*>(header_) + sizeof(queue_header_t);
+    return reinterpret_cast<record_header_t*>(records +
+                                              static_cast<uint64_t>(index % capacity_) *
+                                                  recordStride_);
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -1,18 +1,25 @@
 #include "urf/common/containers/SharedObject.hpp"
 
+#include <climits>
 #include <iostream>
 
 namespace urf {
 namespace common {
 namespace containers {
 
-SharedObject::SharedObject(const std::string& name, uint32_t fileSize) :
+// Mappings are always backed by the paging file here, and large pages need a privilege and a
+// large page aligned size: only prefault and lockMemory are honored
+SharedObject::SharedObject(const std::string& name, uint32_t fileSize, const Options& options) :
     filename_("Local\\"+name),
     stringStart_(),
     filesize_(fileSize),
     hMapFile_(),
     pBuf_(),
-    mtx_() {
+    mtx_(),
+    updateSemaphore_(),
+    mmapHeader_() {
+        const uint64_t mappingSize = static_cast<uint64_t>(filesize_) + sizeof(mmap_header_t);
+
         hMapFile_ = OpenFileMapping(
                         FILE_MAP_ALL_ACCESS,        // read/write access
                         FALSE,                      // do not inherit the name
@@ -25,8 +32,8 @@ SharedObject::SharedObject(const std::string& name, uint32_t fileSize) :
                 INVALID_HANDLE_VALUE,               // use paging file
                 NULL,                               // default security
                 PAGE_READWRITE,                     // read/write access
-                (filesize_ >> 16) & 0xFFFF,                                  // maximum object size (high-order DWORD)
-                filesize_ & 0xFFFF,                          // maximum object size (low-order DWORD)
+                static_cast<DWORD>(mappingSize >> 32),       // maximum object size (high-order DWORD)
+                static_cast<DWORD>(mappingSize & 0xFFFFFFFF), // maximum object size (low-order DWORD)
                 filename_.c_str());                 // name of mapping object
 
             if (hMapFile_ == NULL) {
@@ -36,21 +43,40 @@ SharedObject::SharedObject(const std::string& name, uint32_t fileSize) :
             created = true;
         }
 
-        stringStart_ = (char*) MapViewOfFile(hMapFile_,   // handle to map object
+        pBuf_ = (LPCTSTR) MapViewOfFile(hMapFile_,   // handle to map object
                     FILE_MAP_ALL_ACCESS, // read/write permission
                     0,
                     0,
-                    filesize_);
+                    static_cast<SIZE_T>(mappingSize));
 
-        if (stringStart_ == NULL) {
+        if (pBuf_ == NULL) {
             throw std::runtime_error("Could not create map view of file: " + std::to_string(GetLastError()));
         }
 
+        if (options.lockMemory && !VirtualLock(const_cast<TCHAR*>(pBuf_), static_cast<SIZE_T>(mappingSize))) {
+            throw std::runtime_error("Could not lock shared memory: " + std::to_string(GetLastError()));
+        }
+        if (options.prefault) {
+            SYSTEM_INFO systemInfo;
+            GetSystemInfo(&systemInfo);
+            volatile const char* page = reinterpret_cast<volatile const char*>(pBuf_);
+            for (uint64_t i = 0; i < mappingSize; i += systemInfo.dwPageSize) {
+                (void)page[i];
+            }
+        }
+
+        // Pages of a new mapping backed by the paging file are zero initialized
+        mmapHeader_ = reinterpret_cast<mmap_header_t*>(const_cast<TCHAR*>(pBuf_));
+        stringStart_ = reinterpret_cast<char*>(mmapHeader_) + sizeof(mmap_header_t);
+
         std::string mutexName("mmap_mutex_" + name);
+        std::string semaphoreName("mmap_update_" + name);
         if (created) {
             mtx_ = CreateMutex(NULL, false, mutexName.c_str());
+            updateSemaphore_ = CreateSemaphore(NULL, 0, LONG_MAX, semaphoreName.c_str());
         } else {
             mtx_ = OpenMutex(MUTEX_ALL_ACCESS, FALSE, mutexName.c_str());
+            updateSemaphore_ = OpenSemaphore(SEMAPHORE_ALL_ACCESS, FALSE, semaphoreName.c_str());
         }
 }
 
@@ -59,25 +85,35 @@ SharedObject::~SharedObject() {
     UnmapViewOfFile(pBuf_);
 }
 
-bool SharedObject::write(const std::string& bytes, uint32_t offset) {
-    if (bytes.length() + offset > filesize_) {
-        return false;
+void SharedObject::notifyWaiters() {
+    // Releases one unit per waiter, stale units only cause a spurious wake up and a re-check
+    uint32_t waiters = mmapHeader_->waiters.load(std::memory_order_seq_cst);
+    if (waiters > 0) {
+        ReleaseSemaphore(updateSemaphore_, static_cast<LONG>(waiters), NULL);
     }
-
-    std::memset(stringStart_+offset+bytes.length(), 0, filesize_-offset-bytes.length());
-    std::memcpy(stringStart_+offset, bytes.c_str(), bytes.length());
-    return true;
 }
 
-std::string SharedObject::read(uint32_t length) {
-    if (length > filesize_) {
-        return std::string();
-    }
+bool SharedObject::waitForUpdate(uint32_t version, const std::chrono::milliseconds& timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        mmapHeader_->waiters.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t sequence = mmapHeader_->sequence.load(std::memory_order_seq_cst);
+        if (((sequence & 1) == 0) && (sequence != version)) {
+            mmapHeader_->waiters.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::nanoseconds(0)) {
+            mmapHeader_->waiters.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
 
-    if (length == 0) {
-        return std::string(stringStart_);
+        // Rounded up, a sub-millisecond remainder must not turn into a 0 ms wait
+        auto millis = std::chrono::ceil<std::chrono::milliseconds>(remaining);
+        WaitForSingleObject(updateSemaphore_, static_cast<DWORD>(millis.count()));
+        mmapHeader_->waiters.fetch_sub(1, std::memory_order_relaxed);
     }
-    return std::string(stringStart_, length);
 }
 
 bool SharedObject::lock() {
@@ -0,0 +1,87 @@
+#include "urf/common/events/event_bus.hpp"
+
+namespace urf {
+namespace common {
+namespace events {
+
+event_bus& event_bus::instance() {
+    static event_bus bus;
+    return bus;
+}
+
+event_bus::event_bus()
+    : _mutex()
+    , _routes(std::make_shared<const routing_table>())
+    , _prefixSubscriptions() { }
+
+std::vector<std::string> event_bus::topics() const {
+    auto routes = std::atomic_load(&_routes);
+    std::vector<std::string> names;
+    for (auto& entry : *routes) {
+        names.push_back(entry.second.name);
+    }
+    return names;
+}
+
+event_base& event_bus::findOrCreate(const std::string& name,
+                                    const std::type_index& type,
+                                    const std::function<std::shared_ptr<event_base>()>& factory) {
+    topic_id id = hashTopic(name);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _routes->find(id);
+    if (found != _routes->end()) {
+        if (found->second.name != name) {
+            throw std::runtime_error("Topics " + name + " and " + found->second.name +
+                                     " have the same hash");
+        }
+        if (found->second.type != type) {
+            throw std::invalid_argument("Topic " + name + " exists with different arguments");
+        }
+        return *found->second.event;
+    }
+
+    auto topicEvent = factory();
+    for (auto& subscription : _prefixSubscriptions) {
+        if ((subscription.type == type) && (name.compare(0, subscription.prefix.length(),
+                                                         subscription.prefix) == 0)) {
+            subscription.subscribe(*topicEvent);
+        }
+    }
+
+    auto routes = std::make_shared<routing_table>(*_routes);
+    routes->emplace(id, route{name, type, topicEvent});
+    std::atomic_store(&_routes, std::shared_ptr<const routing_table>(std::move(routes)));
+    return *topicEvent;
+}
+
+void event_bus::addPrefixSubscription(prefix_subscription&& subscription) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& entry : *_routes) {
+        const route& topicRoute = entry.second;
+        if ((topicRoute.type == subscription.type) &&
+            (topicRoute.name.compare(0, subscription.prefix.length(), subscription.prefix) == 0)) {
+            subscription.subscribe(*topicRoute.event);
+        }
+    }
+    _prefixSubscriptions.push_back(std::move(subscription));
+}
+
+event_base* event_bus::find(topic_id id, const std::type_index& type) const {
+    auto routes = std::atomic_load(&_routes);
+    auto found = routes->find(id);
+    if (found == routes->end()) {
+        return nullptr;
+    }
+
+    if (found->second.type != type) {
+        throw std::invalid_argument("Topic " + found->second.name +
+                                    " is published with different arguments");
+    }
+    // Routes are never removed, the event outlives the table snapshot
+    return found->second.event.get();
+}
+
+} // namespace events
+} // namespace common
+} // namespace urf
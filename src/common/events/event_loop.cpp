@@ -0,0 +1,56 @@
+#include "urf/common/events/event_loop.hpp"
+
+namespace urf {
+namespace common {
+namespace events {
+
+void event_loop::post(std::function<void()> task) {
+    tasks_.push(std::move(task));
+}
+
+size_t event_loop::processEvents() {
+    size_t queued = tasks_.size();
+    size_t processed = 0;
+    while (processed < queued) {
+        auto task = tasks_.pop(std::chrono::milliseconds(0));
+        if (!task) {
+            break;
+        }
+
+        (*task)();
+        processed++;
+    }
+    return processed;
+}
+
+size_t event_loop::processEvents(const std::chrono::milliseconds& timeout) {
+    if (!tasks_.empty()) {
+        return processEvents();
+    }
+
+    auto task = tasks_.pop(timeout);
+    if (!task) {
+        return 0;
+    }
+
+    (*task)();
+    return 1 + processEvents();
+}
+
+size_t event_loop::pending() {
+    return tasks_.size();
+}
+
+void event_loop::notifyAll() {
+    tasks_.notifyAll();
+}
+
+#ifdef __linux__
+int event_loop::eventFd() {
+    return tasks_.eventFd();
+}
+#endif
+
+} // namespace events
+} // namespace common
+} // namespace urf
@@ -0,0 +1,100 @@
+#include "urf/common/events/event_trace.hpp"
+
+#include <algorithm>
+
+namespace urf {
+namespace common {
+namespace events {
+
+namespace {
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<std::weak_ptr<event_trace>>& registry() {
+    static std::vector<std::weak_ptr<event_trace>> traces;
+    return traces;
+}
+
+std::vector<std::shared_ptr<event_trace>> livingTraces() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    std::vector<std::shared_ptr<event_trace>> traces;
+    for (auto& weakTrace : registry()) {
+        if (auto trace = weakTrace.lock()) {
+            traces.push_back(std::move(trace));
+        }
+    }
+    return traces;
+}
+
+} // namespace
+
+std::shared_ptr<event_trace> event_trace::create(const std::string& name) {
+    std::shared_ptr<event_trace> trace(new event_trace(name));
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    auto& traces = registry();
+    traces.erase(std::remove_if(traces.begin(),
+                                traces.end(),
+                                [](const std::weak_ptr<event_trace>& weakTrace) {
+                                    return weakTrace.expired();
+                                }),
+                 traces.end());
+    traces.push_back(trace);
+    return trace;
+}
+
+event_trace::event_trace(const std::string& name)
+    : _name(name)
+    , _mutex()
+    , _subscribers() { }
+
+const std::string& event_trace::name() const {
+    return _name;
+}
+
+void event_trace::record(size_t subscriber,
+                         const std::chrono::nanoseconds& queueDelay,
+                         const std::chrono::nanoseconds& callbackDuration) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    while (_subscribers.size() <= subscriber) {
+        _subscribers.push_back({_name, _subscribers.size(), {}, {}});
+    }
+
+    _subscribers[subscriber].queueDelay.record(queueDelay);
+    _subscribers[subscriber].callbackDuration.record(callbackDuration);
+}
+
+std::vector<subscriber_trace> event_trace::snapshot() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _subscribers;
+}
+
+void event_trace::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& subscriber : _subscribers) {
+        subscriber.queueDelay.reset();
+        subscriber.callbackDuration.reset();
+    }
+}
+
+std::vector<subscriber_trace> event_trace::snapshotAll() {
+    std::vector<subscriber_trace> snapshot;
+    for (auto& trace : livingTraces()) {
+        auto subscribers = trace->snapshot();
+        snapshot.insert(snapshot.end(), subscribers.begin(), subscribers.end());
+    }
+    return snapshot;
+}
+
+void event_trace::resetAll() {
+    for (auto& trace : livingTraces()) {
+        trace->reset();
+    }
+}
+
+} // namespace events
+} // namespace common
+} // namespace urf
@@ -1,11 +1,63 @@
 #include "urf/common/events/events.hpp"
 
+#include <thread>
+
+#include "urf/common/containers/ThreadSafeDeadlineQueue.hpp"
+
 namespace urf {
 namespace common {
 namespace events {
 
+namespace {
+
+class delayed_dispatcher {
+ public:
+    delayed_dispatcher()
+        : _tasks()
+        , _thread([this]() { run(); }) { }
+
+    ~delayed_dispatcher() {
+        _tasks.dispose();
+        _thread.join();
+    }
+
+    void push(std::function<void()>&& task, const std::chrono::steady_clock::time_point& time) {
+        _tasks.push(std::move(task), time);
+    }
+
+ private:
+    void run() {
+        while (!_tasks.isDisposed()) {
+            auto task = _tasks.pop();
+            if (task) {
+                (*task)();
+            }
+        }
+    }
+
+ private:
+    containers::ThreadSafeDeadlineQueue<std::function<void()>> _tasks;
+    std::thread _thread;
+};
+
+} // namespace
+
 threading::ThreadPool event_base::_threadPool(1);
 
+void event_base::setDispatchThreads(threading::concurrency_t count) {
+    _threadPool.reset(count);
+}
+
+threading::concurrency_t event_base::dispatchThreads() {
+    return _threadPool.getThreadCount();
+}
+
+void event_base::scheduleAt(const std::chrono::steady_clock::time_point& time,
+                            std::function<void()> task) {
+    static delayed_dispatcher dispatcher;
+    dispatcher.push(std::move(task), time);
+}
+
 } // namespace events
 } // namespace common
 } // namespace urf
\ No newline at end of file
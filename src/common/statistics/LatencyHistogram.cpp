@@ -0,0 +1,97 @@
+#include "urf/common/statistics/LatencyHistogram.hpp"
+
+#include <algorithm>
+
+namespace urf {
+namespace common {
+namespace statistics {
+
+LatencyHistogram::LatencyHistogram()
+    : buckets_()
+    , count_(0)
+    , sum_(0)
+    , min_(std::chrono::nanoseconds::max())
+    , max_(0) {
+    buckets_.fill(0);
+}
+
+void LatencyHistogram::record(const std::chrono::nanoseconds& duration) {
+    auto micros = static_cast<uint64_t>(std::max<int64_t>(
+        0, std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+
+    size_t bucket = 0;
+    while ((micros > 0) && (bucket < BucketsCount - 1)) {
+        micros >>= 1;
+        bucket++;
+    }
+
+    buckets_[bucket]++;
+    count_++;
+    sum_ += duration;
+    min_ = std::min(min_, duration);
+    max_ = std::max(max_, duration);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < BucketsCount; i++) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::reset() {
+    *this = LatencyHistogram();
+}
+
+uint64_t LatencyHistogram::count() const {
+    return count_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::min() const {
+    return count_ == 0 ? std::chrono::nanoseconds(0) : min_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::max() const {
+    return max_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::mean() const {
+    if (count_ == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    return sum_ / count_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::percentile(double value) const {
+    if (count_ == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+
+    auto target = static_cast<uint64_t>(std::clamp(value, 0.0, 100.0) / 100.0 * count_);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < BucketsCount; i++) {
+        cumulative += buckets_[i];
+        if ((cumulative >= target) && (cumulative > 0)) {
+            return std::min(bucketUpperBound(i), max_);
+        }
+    }
+    return max_;
+}
+
+const std::array<uint64_t, LatencyHistogram::BucketsCount>& LatencyHistogram::buckets() const {
+    return buckets_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::bucketUpperBound(size_t bucket) {
+    if (bucket >= BucketsCount - 1) {
+        return std::chrono::nanoseconds::max();
+    }
+    return std::chrono::microseconds(uint64_t(1) << bucket);
+}
+
+} // namespace statistics
+} // namespace common
+} // namespace urf
@@ -0,0 +1,62 @@
+#include "urf/common/threading/Strand.hpp"
+
+namespace urf {
+namespace common {
+namespace threading {
+
+Strand::Strand(ThreadPool& pool)
+    : pool_(pool)
+    , state_(std::make_shared<State>()) { }
+
+void Strand::post(std::function<void()> task) {
+    {
+        std::scoped_lock<std::mutex> guard(state_->mtx);
+        state_->tasks.push_back(std::move(task));
+        if (state_->scheduled) {
+            return;
+        }
+        state_->scheduled = true;
+    }
+
+    auto state = state_;
+    auto& pool = pool_;
+    pool_.pushTask([&pool, state]() { drain(pool, state); });
+}
+
+size_t Strand::pending() const {
+    std::scoped_lock<std::mutex> guard(state_->mtx);
+    return state_->tasks.size();
+}
+
+void Strand::drain(ThreadPool& pool, const std::shared_ptr<State>& state) {
+    size_t batch = 0;
+    {
+        std::scoped_lock<std::mutex> guard(state->mtx);
+        batch = state->tasks.size();
+    }
+
+    // Runs only what was queued when the drain started, then yields the pool thread so that a
+    // busy strand does not starve the others
+    for (size_t i = 0; i < batch; i++) {
+        std::function<void()> task;
+        {
+            std::scoped_lock<std::mutex> guard(state->mtx);
+            task = std::move(state->tasks.front());
+            state->tasks.pop_front();
+        }
+        task();
+    }
+
+    {
+        std::scoped_lock<std::mutex> guard(state->mtx);
+        if (state->tasks.empty()) {
+            state->scheduled = false;
+            return;
+        }
+    }
+    pool.pushTask([&pool, state]() { drain(pool, state); });
+}
+
+} // namespace threading
+} // namespace common
+} // namespace urf
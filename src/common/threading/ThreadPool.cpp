@@ -4,6 +4,12 @@ namespace urf {
 namespace common {
 namespace threading {
 
+namespace {
+
+thread_local const ThreadPool* currentPool = nullptr;
+
+} // namespace
+
 ThreadPool::ThreadPool(const concurrency_t thread_count)
     : thread_count_(determineThreadCount(thread_count))
     , threads(std::make_unique<std::thread[]>(thread_count_)) {
@@ -19,6 +25,18 @@ concurrency_t ThreadPool::getThreadCount() const {
     return thread_count_;
 }
 
+bool ThreadPool::isWorkerThread() const {
+    return currentPool == this;
+}
+
+void ThreadPool::reset(const concurrency_t thread_count) {
+    waitForTasks();
+    destroyThreads();
+    thread_count_ = determineThreadCount(thread_count);
+    threads = std::make_unique<std::thread[]>(thread_count_);
+    createThreads();
+}
+
 void ThreadPool::createThreads() {
     running = true;
     for (concurrency_t i = 0; i < thread_count_; ++i) {
@@ -46,6 +64,7 @@ concurrency_t ThreadPool::determineThreadCount(const concurrency_t thread_count_
 }
 
 void ThreadPool::worker() {
+    currentPool = this;
     while (running) {
         std::function<void()> task;
         std::unique_lock<std::mutex> tasks_lock(tasks_mutex);
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Hook to be inherited by the elements of an IntrusiveMpscQueue.
+ */
+struct MpscQueueHook {
+    std::atomic<MpscQueueHook*> mpscNext = nullptr;
+};
+
+/**
+ * Intrusive lock-free multi producer single consumer queue (D. Vyukov's algorithm). Producers
+ * never block: a push is one atomic exchange plus one store, and the consumer is woken only if it
+ * is parked waiting for elements. Elements are not copied nor allocated, the queue links the
+ * MpscQueueHook they inherit from and the caller keeps their ownership. A popped element does not
+ * reference the queue anymore, so it can be reused (pushed again) right away, e.g. by recycling
+ * it through a pool owned by the consumer.
+ *
+ * push() can be called from any thread, while the pop functions from one consumer thread only.
+ */
+template <class T>
+class IntrusiveMpscQueue {
+    static_assert(std::is_base_of_v<MpscQueueHook, T>, "T must inherit from MpscQueueHook");
+
+ public:
+    IntrusiveMpscQueue();
+    IntrusiveMpscQueue(const IntrusiveMpscQueue&) = delete;
+    IntrusiveMpscQueue(IntrusiveMpscQueue&&) = delete;
+    ~IntrusiveMpscQueue() = default;
+
+    void push(T* element);
+
+    T* tryPop();
+    T* pop();
+    T* pop(const std::chrono::milliseconds& timeout);
+
+    bool empty() const;
+
+    void notifyAll();
+
+ private:
+    void link(MpscQueueHook* node);
+    T* popUntil(const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+ private:
+    // Producers side
+    std::atomic<MpscQueueHook*> head_;
+    // Consumer side
+    MpscQueueHook* tail_;
+    MpscQueueHook stub_;
+
+    std::atomic<bool> parked_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool notifySent_;
+};
+
+template <class T>
+IntrusiveMpscQueue<T>::IntrusiveMpscQueue()
+    : head_(&stub_)
+    , tail_(&stub_)
+    , stub_()
+    , parked_(false)
+    , mtx_()
+    , cv_()
+    , notifySent_(false) { }
+
+template <class T>
+void IntrusiveMpscQueue<T>::push(T* element) {
+    link(element);
+
+    // Pairs with the fence in popUntil: either the consumer sees the element or we see it parked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked_.load(std::memory_order_relaxed)) {
+        std::scoped_lock<std::mutex> guard(mtx_);
+        cv_.notify_one();
+    }
+}
+
+template <class T>
+T* IntrusiveMpscQueue<T>::tryPop() {
+    MpscQueueHook* tail = tail_;
+    MpscQueueHook* next = tail->mpscNext.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+        if (next == nullptr) {
+            return nullptr;
+        }
+        tail_ = next;
+        tail = next;
+        next = next->mpscNext.load(std::memory_order_acquire);
+    }
+
+    if (next != nullptr) {
+        tail_ = next;
+        return static_cast<T*>(tail);
+    }
+
+    // tail is the last linked element. If head moved on, a producer exchanged head but did not
+    // link its element yet: the queue is momentarily inconsistent and looks empty
+    if (tail != head_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    // Put the stub back behind the last element so that the last element can be detached
+    link(&stub_);
+    next = tail->mpscNext.load(std::memory_order_acquire);
+    if (next != nullptr) {
+        tail_ = next;
+        return static_cast<T*>(tail);
+    }
+    return nullptr;
+}
+
+template <class T>
+T* IntrusiveMpscQueue<T>::pop() {
+    return popUntil(std::nullopt);
+}
+
+template <class T>
+T* IntrusiveMpscQueue<T>::pop(const std::chrono::milliseconds& timeout) {
+    return popUntil(std::chrono::steady_clock::now() + timeout);
+}
+
+template <class T>
+bool IntrusiveMpscQueue<T>::empty() const {
+    return (tail_ == &stub_) && (stub_.mpscNext.load(std::memory_order_acquire) == nullptr);
+}
+
+template <class T>
+void IntrusiveMpscQueue<T>::notifyAll() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    notifySent_ = true;
+    cv_.notify_all();
+}
+
+template <class T>
+void IntrusiveMpscQueue<T>::link(MpscQueueHook* node) {
+    node->mpscNext.store(nullptr, std::memory_order_relaxed);
+    MpscQueueHook* prev = head_.exchange(node, std::memory_order_acq_rel);
+    prev->mpscNext.store(node, std::memory_order_release);
+}
+
+template <class T>
+T* IntrusiveMpscQueue<T>::popUntil(
+    const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    {
+        std::scoped_lock<std::mutex> guard(mtx_);
+        notifySent_ = false;
+    }
+
+    while (true) {
+        T* element = tryPop();
+        if (element != nullptr) {
+            return element;
+        }
+
+        std::unique_lock<std::mutex> lock(mtx_);
+        parked_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        element = tryPop();
+        if ((element != nullptr) || notifySent_) {
+            parked_.store(false, std::memory_order_relaxed);
+            return element;
+        }
+
+        if (!deadline) {
+            cv_.wait(lock);
+        } else if (cv_.wait_until(lock, *deadline) == std::cv_status::timeout) {
+            parked_.store(false, std::memory_order_relaxed);
+            return tryPop();
+        }
+        parked_.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
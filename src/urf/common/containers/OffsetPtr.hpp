@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Pointer stored as the distance from its own address, so that it stays valid when the shared
+ * segment containing both the pointer and the pointee is mapped at different addresses by
+ * different processes. It must only point inside the segment it lives in.
+ */
+template <class T>
+class OffsetPtr {
+ public:
+    OffsetPtr();
+    OffsetPtr(T* pointer);
+    OffsetPtr(const OffsetPtr& other);
+    ~OffsetPtr() = default;
+
+    T* get() const;
+    T& operator*() const;
+    T* operator->() const;
+    explicit operator bool() const;
+
+    OffsetPtr& operator=(const OffsetPtr& other);
+    OffsetPtr& operator=(T* pointer);
+
+    bool operator==(const OffsetPtr& other) const;
+    bool operator!=(const OffsetPtr& other) const;
+
+ private:
+    void set(T* pointer);
+
+ private:
+    // A pointer can't point one byte past itself, so 1 encodes nullptr
+    static constexpr std::ptrdiff_t NullOffset = 1;
+
+    std::ptrdiff_t offset_;
+};
+
+template <class T>
+OffsetPtr<T>::OffsetPtr()
+    : offset_(NullOffset) { }
+
+template <class T>
+OffsetPtr<T>::OffsetPtr(T* pointer)
+    : offset_(NullOffset) {
+    set(pointer);
+}
+
+template <class T>
+OffsetPtr<T>::OffsetPtr(const OffsetPtr& other)
+    : offset_(NullOffset) {
+    set(other.get());
+}
+
+template <class T>
+T* OffsetPtr<T>::get() const {
+    if (offset_ == NullOffset) {
+        return nullptr;
+    }
+    return reinterpret_cast<T*>(reinterpret_cast<std::intptr_t>(this) + offset_);
+}
+
+template <class T>
+T& OffsetPtr<T>::operator*() const {
+    return *get();
+}
+
+template <class T>
+T* OffsetPtr<T>::operator->() const {
+    return get();
+}
+
+template <class T>
+OffsetPtr<T>::operator bool() const {
+    return offset_ != NullOffset;
+}
+
+template <class T>
+OffsetPtr<T>& OffsetPtr<T>::operator=(const OffsetPtr& other) {
+    set(other.get());
+    return *this;
+}
+
+template <class T>
+OffsetPtr<T>& OffsetPtr<T>::operator=(T* pointer) {
+    set(pointer);
+    return *this;
+}
+
+template <class T>
+bool OffsetPtr<T>::operator==(const OffsetPtr& other) const {
+    return get() == other.get();
+}
+
+template <class T>
+bool OffsetPtr<T>::operator!=(const OffsetPtr& other) const {
+    return get() != other.get();
+}
+
+template <class T>
+void OffsetPtr<T>::set(T* pointer) {
+    if (pointer == nullptr) {
+        offset_ = NullOffset;
+        return;
+    }
+    offset_ = reinterpret_cast<std::intptr_t>(pointer) - reinterpret_cast<std::intptr_t>(this);
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,76 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "urf/common/containers/QueueSignal.hpp"
+#include "urf/common/containers/ThreadSafeQueue.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Lets a single consumer thread block until any of several ThreadSafeQueues has data. select()
+ * returns the index of a non empty queue (as returned by add), scanning the queues round robin
+ * starting after the last one returned so that a busy queue cannot starve the others. The
+ * element must then be taken with a non blocking pop, e.g. pop(std::chrono::milliseconds(0)).
+ *
+ * The queues must outlive the selector, and add/select are meant to be called by the owning
+ * consumer thread only.
+ */
+class URF_COMMON_EXPORT QueueSelector {
+ public:
+    QueueSelector();
+    QueueSelector(const QueueSelector&) = delete;
+    QueueSelector(QueueSelector&&) = delete;
+    ~QueueSelector();
+
+    template <class T, class Statistics>
+    size_t add(ThreadSafeQueue<T, Statistics>& queue);
+    size_t size() const;
+
+    std::optional<size_t> select();
+    std::optional<size_t> select(const std::chrono::milliseconds& timeout);
+
+    // Releases a blocked select, which returns nullopt
+    void notifyAll();
+
+ private:
+    struct Source {
+        std::function<bool()> ready;
+        std::function<void()> detach;
+    };
+
+    std::optional<size_t> selectUntil(
+        const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+ private:
+    std::shared_ptr<QueueSignal> signal_;
+    std::vector<Source> sources_;
+    size_t next_;
+
+    std::atomic<bool> notifySent_;
+};
+
+template <class T, class Statistics>
+size_t QueueSelector::add(ThreadSafeQueue<T, Statistics>& queue) {
+    queue.attach(signal_);
+    sources_.push_back({[&queue]() { return !queue.empty(); },
+                        [&queue, signal = signal_]() { queue.detach(signal); }});
+    return sources_.size() - 1;
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
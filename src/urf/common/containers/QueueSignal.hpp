@@ -0,0 +1,49 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Generation counter that queues bump whenever they change state. A waiter reads the
+ * generation, checks its queues and then waits for the generation to move on, so that no
+ * notification sent in between can be lost.
+ */
+class URF_COMMON_EXPORT QueueSignal {
+ public:
+    QueueSignal();
+    QueueSignal(const QueueSignal&) = delete;
+    QueueSignal(QueueSignal&&) = delete;
+    ~QueueSignal() = default;
+
+    void notify();
+    uint64_t generation();
+
+    /**
+     * Waits until the generation differs from the given one. Returns false if the deadline
+     * expired first, a nullopt deadline waits forever.
+     */
+    bool waitUntil(uint64_t generation,
+                   const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+ private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    uint64_t generation_;
+};
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,74 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+
+#include "urf/common/statistics/LatencyHistogram.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+struct QueueStatisticsSnapshot {
+    size_t depth = 0;
+    size_t peakDepth = 0;
+    uint64_t pushes = 0;
+    uint64_t pops = 0;
+    // Averages since the statistics were created or last reset, in elements per second
+    double pushRate = 0;
+    double popRate = 0;
+    std::chrono::nanoseconds elapsed = std::chrono::nanoseconds(0);
+    // Time spent in the queue by the popped elements
+    statistics::LatencyHistogram waitTime;
+};
+
+/**
+ * Statistics policies for ThreadSafeQueue. The queue calls the hooks with its lock held and
+ * with the depth after the operation. NoQueueStatistics is the default: its hooks are empty and
+ * inline, and the queue holds it as [[no_unique_address]] so it takes no storage on compilers
+ * honouring the attribute (GCC, Clang). MSVC ignores it and keeps one byte per queue.
+ */
+struct NoQueueStatistics {
+    void onPush(size_t) { }
+    void onPop(size_t) { }
+    void onAssign(size_t) { }
+    void reset(size_t) { }
+    QueueStatisticsSnapshot snapshot() const {
+        return QueueStatisticsSnapshot();
+    }
+};
+
+/**
+ * Timestamps the elements on push and records how long they waited in the queue, the current
+ * and peak depth and the push/pop counts. The queue is FIFO, so timestamps are kept in a
+ * parallel queue instead of being stored with the elements.
+ */
+class URF_COMMON_EXPORT QueueStatistics {
+ public:
+    QueueStatistics();
+
+    void onPush(size_t depth);
+    void onPop(size_t depth);
+    void onAssign(size_t depth);
+    void reset(size_t depth);
+    QueueStatisticsSnapshot snapshot() const;
+
+ private:
+    std::deque<std::chrono::steady_clock::time_point> pushTimes_;
+    std::chrono::steady_clock::time_point start_;
+    size_t peakDepth_;
+    uint64_t pushes_;
+    uint64_t pops_;
+    statistics::LatencyHistogram waitTime_;
+};
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,84 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "urf/common/containers/SharedObject.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Single writer, multiple readers broadcast ring living in a SharedObject segment. Every slot
+ * carries the sequence number of the frame it holds, so each reader keeps its own cursor and
+ * detects when the writer lapped it (overrun): the reader then skips to the oldest frame still
+ * available. The writer never waits for readers.
+ *
+ * Every instance is a reader with its own cursor, starting from the frames pushed after its
+ * construction. Concurrent writers must serialize through lock().
+ */
+class URF_COMMON_EXPORT SharedBroadcastRing {
+ public:
+    SharedBroadcastRing(const std::string& name, uint32_t slotSize, uint32_t slotsCount);
+    SharedBroadcastRing(const SharedBroadcastRing&) = delete;
+    SharedBroadcastRing(SharedBroadcastRing&&) = delete;
+    ~SharedBroadcastRing() = default;
+
+    bool push(const std::string& frame);
+    bool push(const void* frame, uint32_t length);
+
+    std::optional<std::string> read();
+    std::optional<std::string> read(const std::chrono::milliseconds& timeout);
+
+    // Frames this reader lost because the writer overwrote them before they were read
+    uint64_t overruns() const;
+    void seekToLatest();
+    void seekToOldest();
+
+    uint32_t slotSize() const;
+    uint32_t slotsCount() const;
+
+    bool lock();
+    bool unlock();
+
+ private:
+    typedef struct {
+        uint32_t slotSize;
+        uint32_t slotsCount;
+        std::atomic<uint64_t> writeIndex;
+    } ring_header_t;
+
+    typedef struct {
+        // 2 * index + 1 while frame index is being written, 2 * index + 2 once written
+        std::atomic<uint64_t> sequence;
+        uint32_t length;
+        uint32_t reserved;
+    } slot_header_t;
+
+    static uint32_t slotStride(uint32_t slotSize);
+    slot_header_t* slot(uint64_t index) const;
+
+ private:
+    SharedObject object_;
+    ring_header_t* header_;
+    uint32_t slotSize_;
+    uint32_t slotsCount_;
+    uint32_t slotStride_;
+
+    uint64_t cursor_;
+    uint64_t overruns_;
+};
+
+} // namespace containers
+} // namespace common
+} // namespace urf
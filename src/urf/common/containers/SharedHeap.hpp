@@ -0,0 +1,145 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "urf/common/containers/SharedObject.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Allocator state living at the beginning of a shared segment: an address ordered free list
+ * of blocks, allocated first fit and coalesced on release. All positions are offsets from the
+ * arena, so every process can use it whatever the address its mapping got. It is not thread
+ * safe, callers must hold the IPC lock of the owning SharedHeap.
+ */
+class URF_COMMON_EXPORT SharedArena {
+ public:
+    static constexpr size_t Alignment = 16;
+
+    void initialize(uint64_t size);
+    bool initialized() const;
+
+    void* allocate(size_t bytes);
+    void deallocate(void* pointer);
+
+    uint64_t offsetOf(const void* pointer) const;
+    void* at(uint64_t offset) const;
+
+    uint64_t freeBytes() const;
+    uint64_t size() const;
+
+    void* root() const;
+    void setRoot(const void* pointer);
+
+ private:
+    struct Block {
+        uint64_t size;
+        uint64_t nextFree;
+    };
+
+    Block* block(uint64_t offset) const;
+
+ private:
+    uint32_t magic_;
+    uint32_t reserved_;
+    uint64_t size_;
+    uint64_t freeList_;
+    uint64_t freeBytes_;
+    uint64_t root_;
+    uint64_t padding_;
+};
+
+/**
+ * Heap inside a SharedObject segment, where processes allocate, free and share variable
+ * length records in place. Records reference each other through OffsetPtr, and a root record
+ * lets other processes find the data. Containers taking a SharedArena* as first constructor
+ * argument, such as SharedVector and SharedString, can be built inside the segment through
+ * construct().
+ *
+ * Like SharedObject::write, every operation on the heap and on the records it contains must be
+ * done between lock() and unlock().
+ *
+ * The heap content persists in the segment as long as it exists: reset() releases every record
+ * at once, so that a restarted set of processes can reuse the name.
+ */
+class URF_COMMON_EXPORT SharedHeap {
+ public:
+    SharedHeap(const std::string& name, uint32_t size);
+    SharedHeap(const SharedHeap&) = delete;
+    SharedHeap(SharedHeap&&) = delete;
+    ~SharedHeap() = default;
+
+    bool lock();
+    bool unlock();
+
+    // Returns nullptr when the segment has no free block large enough
+    void* allocate(size_t bytes);
+    void deallocate(void* pointer);
+
+    template <class T, class... A>
+    T* construct(A&&... args);
+    template <class T>
+    void destroy(T* object);
+
+    template <class T>
+    T* root() const;
+    void setRoot(const void* pointer);
+    // Releases every record and clears the root, previous pointers into the heap dangle
+    void reset();
+
+    uint64_t offsetOf(const void* pointer) const;
+    void* at(uint64_t offset) const;
+    uint64_t freeBytes() const;
+
+    SharedArena* arena() const;
+
+ private:
+    SharedObject object_;
+    SharedArena* arena_;
+};
+
+template <class T, class... A>
+T* SharedHeap::construct(A&&... args) {
+    void* memory = arena_->allocate(sizeof(T));
+    if (memory == nullptr) {
+        return nullptr;
+    }
+
+    if constexpr (std::is_constructible_v<T, SharedArena*, A...>) {
+        return new (memory) T(arena_, std::forward<A>(args)...);
+    } else {
+        return new (memory) T(std::forward<A>(args)...);
+    }
+}
+
+template <class T>
+void SharedHeap::destroy(T* object) {
+    if (object == nullptr) {
+        return;
+    }
+
+    object->~T();
+    arena_->deallocate(object);
+}
+
+template <class T>
+T* SharedHeap::root() const {
+    return static_cast<T*>(arena_->root());
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,107 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "urf/common/containers/SharedObject.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Fixed capacity hash table holding many named entries in a single SharedObject segment, instead
+ * of one segment per value. Keys are placed with open addressing (linear probing) in slots of
+ * fixed key and value size.
+ *
+ * Writers serialize through the IPC lock, while get() takes no lock at all: every slot is
+ * guarded by its own sequence counter (seqlock), so a lookup is a hash plus a few memory reads
+ * retried only when racing with a writer on the same slot.
+ *
+ * Erased entries leave tombstones so that probe chains stay intact. The ones at the end of a
+ * chain are reclaimed on erase, but tombstones between live entries remain until the slot is
+ * reused by an insertion or clear() is called: a table with heavy churn and a high load factor
+ * degrades towards a linear scan for absent keys.
+ */
+class URF_COMMON_EXPORT SharedKeyValueStore {
+ public:
+    SharedKeyValueStore(const std::string& name,
+                        uint32_t capacity,
+                        uint32_t keySize,
+                        uint32_t valueSize);
+    SharedKeyValueStore(const SharedKeyValueStore&) = delete;
+    SharedKeyValueStore(SharedKeyValueStore&&) = delete;
+    ~SharedKeyValueStore() = default;
+
+    // Fails when the key or the value are too long or when the table is full
+    bool set(const std::string& key, const std::string& value);
+    std::optional<std::string> get(const std::string& key) const;
+    bool contains(const std::string& key) const;
+    bool erase(const std::string& key);
+    void clear();
+
+    size_t size();
+    std::vector<std::string> keys();
+
+    uint32_t capacity() const;
+    uint32_t keySize() const;
+    uint32_t valueSize() const;
+
+ private:
+    enum slot_state : uint32_t { Empty = 0, Used = 1, Erased = 2 };
+
+    typedef struct {
+        uint32_t capacity;
+        uint32_t keySize;
+        uint32_t valueSize;
+        uint32_t count;
+    } table_header_t;
+
+    typedef struct {
+        // Odd while the slot is being written
+        std::atomic<uint32_t> sequence;
+        uint32_t state;
+        uint32_t hash;
+        uint32_t keyLength;
+        uint32_t valueLength;
+        uint32_t reserved;
+    } slot_header_t;
+
+    static uint32_t hashOf(const std::string& key);
+    static uint64_t slotStride(uint32_t keySize, uint32_t valueSize);
+    static uint32_t segmentSize(uint32_t capacity, uint32_t keySize, uint32_t valueSize);
+
+    slot_header_t* slot(uint32_t index) const;
+    char* keyOf(slot_header_t* entry) const;
+    char* valueOf(slot_header_t* entry) const;
+    bool matches(slot_header_t* entry, uint32_t hash, const std::string& key) const;
+
+    uint32_t probeIndex(uint32_t hash, uint32_t probe) const;
+    // Empties the tombstones preceding index, which must be an empty slot. Requires lock
+    void reclaimTombstones(uint32_t index);
+    // Index of the slot holding the key, or of the slot where it would be inserted. Requires lock
+    std::optional<uint32_t> find(const std::string& key, uint32_t hash, bool& found) const;
+    void beginSlotWrite(slot_header_t* entry);
+    void endSlotWrite(slot_header_t* entry);
+
+ private:
+    SharedObject object_;
+    table_header_t* header_;
+    uint32_t capacity_;
+    uint32_t keySize_;
+    uint32_t valueSize_;
+    uint64_t slotStride_;
+};
+
+} // namespace containers
+} // namespace common
+} // namespace urf
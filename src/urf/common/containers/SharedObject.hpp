@@ -6,7 +6,12 @@
     #define URF_COMMON_EXPORT
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
@@ -25,12 +30,76 @@ namespace containers {
 
 class URF_COMMON_EXPORT SharedObject {
  public:
+    struct Range {
+        uint32_t offset;
+        const void* bytes;
+        uint32_t length;
+    };
+
+    /**
+     * Placement of the segment. All the processes sharing an object must use the same backing.
+     * hugePages is advisory (transparent huge pages), prefault maps every page upfront and
+     * lockMemory keeps them resident, so that accesses never fault nor write back to disk.
+     */
+    enum class Backing { File, PosixShm };
+    struct Options {
+        Backing backing = Backing::File;
+        bool hugePages = false;
+        bool prefault = false;
+        bool lockMemory = false;
+    };
+
     SharedObject(const std::string& name, uint32_t fileSize);
+    SharedObject(const std::string& name, uint32_t fileSize, const Options& options);
     ~SharedObject();
 
+    /**
+     * Copies the bytes at the given offset, the stored payload length becomes offset + length.
+     * A read with length 0 returns the whole stored payload, NUL bytes included. Only the
+     * written bytes are touched (plus the gap, zeroed, when writing past the payload end).
+     */
     bool write(const std::string& bytes, uint32_t offset = 0);
+    bool writeBytes(const void* bytes, uint32_t length, uint32_t offset = 0);
+    /**
+     * Updates several regions in place, published at once to snapshot() readers. The payload
+     * length grows to cover every range but is never shortened. Fails without writing anything
+     * if a range does not fit.
+     */
+    bool writev(const std::vector<Range>& ranges);
     std::string read(uint32_t length = 0);
 
+    /**
+     * Zero-copy access to the mapped payload, which is valid for the lifetime of the object.
+     * Accesses must be protected by lock() when other processes may write concurrently.
+     */
+    const char* data() const;
+    uint32_t size() const;
+    uint32_t capacity() const;
+
+    /**
+     * In place write: beginWrite() returns the writable payload, endWrite() publishes the new
+     * payload length. Readers using snapshot() never observe a partially written payload.
+     */
+    char* beginWrite();
+    void endWrite(uint32_t length);
+
+    /**
+     * Change notification across processes. version() changes after every completed write and
+     * waitForUpdate() blocks until it differs from the given one, returning false on timeout.
+     * It must be called without holding lock(), writers wake waiters without taking it.
+     */
+    uint32_t version() const;
+    bool waitForUpdate(uint32_t version, const std::chrono::milliseconds& timeout);
+
+    /**
+     * Lock-free consistent read (seqlock): write() bumps a sequence counter stored in the shared
+     * header before and after copying, and the snapshot is retried until no write overlapped
+     * the copy. It is meant for a single writer, concurrent writers must still use lock().
+     */
+    std::string snapshot(uint32_t length = 0);
+    // Same as above, copying exactly length bytes into destination without allocating
+    bool snapshot(void* destination, uint32_t length);
+
     bool lock();
     bool unlock();
 
@@ -39,13 +108,25 @@ class URF_COMMON_EXPORT SharedObject {
     char* stringStart_;
     uint32_t filesize_;
 
+    static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                  "the sequence counter is shared between processes");
+
+    std::string copyPayload(uint32_t length) const;
+    // Wakes up the waitForUpdate() callers after a write, implemented by each platform
+    void notifyWaiters();
+
 #ifdef __linux__
     int fd_;
 
-    typedef struct {
+    // The payload starts right after the header, which keeps it aligned for any type
+    typedef struct alignas(std::max_align_t) {
         pthread_mutex_t ipc_mutex;
-    } mmap_mutex_t;
-    mmap_mutex_t* mmapMutex_;
+        // Also used as futex word by waitForUpdate
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> length;
+        std::atomic<uint32_t> waiters;
+    } mmap_header_t;
+    mmap_header_t* mmapHeader_;
 
     void* completeMmap_;
 
@@ -53,7 +134,18 @@ class URF_COMMON_EXPORT SharedObject {
     HANDLE hMapFile_;
     LPCTSTR pBuf_;
     HANDLE mtx_;
+    HANDLE updateSemaphore_;
+
+    typedef struct alignas(std::max_align_t) {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> length;
+        std::atomic<uint32_t> waiters;
+    } mmap_header_t;
+    mmap_header_t* mmapHeader_;
 #endif
+
+    static_assert(sizeof(mmap_header_t) % alignof(std::max_align_t) == 0,
+                  "the payload must be aligned for any type");
 };
 
 }  // namespace containers
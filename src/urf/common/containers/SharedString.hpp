@@ -0,0 +1,48 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <string>
+
+#include "urf/common/containers/SharedHeap.hpp"
+#include "urf/common/containers/SharedVector.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * NUL terminated string stored in a SharedHeap, with the same usage rules of SharedVector.
+ */
+class URF_COMMON_EXPORT SharedString {
+ public:
+    explicit SharedString(SharedArena* arena);
+    SharedString(SharedArena* arena, const std::string& value);
+    SharedString(const SharedString&) = delete;
+    SharedString(SharedString&&) = delete;
+    ~SharedString() = default;
+
+    size_t size() const;
+    bool empty() const;
+    const char* c_str() const;
+    std::string str() const;
+
+    void assign(const std::string& value);
+    void append(const std::string& value);
+    void clear();
+
+    SharedString& operator=(const std::string& value);
+    bool operator==(const std::string& value) const;
+    bool operator!=(const std::string& value) const;
+
+ private:
+    SharedVector<char> chars_;
+};
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "urf/common/containers/SharedObject.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Maps a fixed layout struct directly into a SharedObject segment, without serialization. The
+ * struct is zero initialized when the segment is created.
+ *
+ * get() gives read-only in place access and must be used between lock() and unlock(). Writes
+ * go through update(), which modifies the struct in place under the IPC lock, or store(), which
+ * overwrites it, so that every change is published to snapshot() readers. snapshot() returns a
+ * consistent copy without taking the lock (seqlock); since it retries while a write overlaps
+ * the copy it is best suited for small structs.
+ */
+template <class T>
+class SharedStruct {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SharedStruct requires a trivially copyable type");
+    static_assert(std::is_standard_layout_v<T>,
+                  "SharedStruct requires a standard layout type");
+    static_assert(alignof(T) <= alignof(uint64_t),
+                  "SharedStruct payload is only guaranteed to be 8 bytes aligned");
+
+ public:
+    explicit SharedStruct(const std::string& name);
+    SharedStruct(const SharedStruct&) = delete;
+    SharedStruct(SharedStruct&&) = delete;
+    ~SharedStruct() = default;
+
+    bool lock();
+    bool unlock();
+
+    const T* get() const;
+
+    template <class F>
+    bool update(F&& modifier);
+    bool store(const T& value);
+    T load();
+    T snapshot();
+
+ private:
+    SharedObject object_;
+};
+
+template <class T>
+SharedStruct<T>::SharedStruct(const std::string& name)
+    : object_(name, sizeof(T)) { }
+
+template <class T>
+bool SharedStruct<T>::lock() {
+    return object_.lock();
+}
+
+template <class T>
+bool SharedStruct<T>::unlock() {
+    return object_.unlock();
+}
+
+template <class T>
+const T* SharedStruct<T>::get() const {
+    return reinterpret_cast<const T*>(object_.data());
+}
+
+template <class T>
+template <class F>
+bool SharedStruct<T>::update(F&& modifier) {
+    if (!object_.lock()) {
+        return false;
+    }
+
+    modifier(*reinterpret_cast<T*>(object_.beginWrite()));
+    object_.endWrite(sizeof(T));
+    return object_.unlock();
+}
+
+template <class T>
+bool SharedStruct<T>::store(const T& value) {
+    if (!object_.lock()) {
+        return false;
+    }
+
+    object_.writeBytes(&value, sizeof(T));
+    return object_.unlock();
+}
+
+template <class T>
+T SharedStruct<T>::load() {
+    T value;
+    object_.lock();
+    value = *get();
+    object_.unlock();
+    return value;
+}
+
+template <class T>
+T SharedStruct<T>::snapshot() {
+    T value;
+    object_.snapshot(&value, sizeof(T));
+    return value;
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "urf/common/containers/OffsetPtr.hpp"
+#include "urf/common/containers/SharedHeap.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Growable array of trivially copyable elements stored in a SharedHeap. Both the vector and its
+ * elements live in the segment, so it has to be created with SharedHeap::construct() and used
+ * while holding the heap lock.
+ */
+template <class T>
+class SharedVector {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SharedVector elements are copied between processes as raw bytes");
+
+ public:
+    explicit SharedVector(SharedArena* arena);
+    SharedVector(const SharedVector&) = delete;
+    SharedVector(SharedVector&&) = delete;
+    ~SharedVector();
+
+    size_t size() const;
+    size_t capacity() const;
+    size_t max_size() const;
+    bool empty() const;
+
+    T* data() const;
+    T* begin() const;
+    T* end() const;
+    T& operator[](size_t index) const;
+    T& at(size_t index) const;
+
+    void reserve(size_t capacity);
+    void resize(size_t size);
+    void push_back(const T& element);
+    void pop_back();
+    void assign(const T* elements, size_t count);
+    void clear();
+
+    SharedVector& operator=(const SharedVector&) = delete;
+
+ private:
+    OffsetPtr<SharedArena> arena_;
+    OffsetPtr<T> data_;
+    uint64_t size_;
+    uint64_t capacity_;
+};
+
+template <class T>
+SharedVector<T>::SharedVector(SharedArena* arena)
+    : arena_(arena)
+    , data_()
+    , size_(0)
+    , capacity_(0) { }
+
+template <class T>
+SharedVector<T>::~SharedVector() {
+    arena_->deallocate(data_.get());
+}
+
+template <class T>
+size_t SharedVector<T>::size() const {
+    return static_cast<size_t>(size_);
+}
+
+template <class T>
+size_t SharedVector<T>::capacity() const {
+    return static_cast<size_t>(capacity_);
+}
+
+template <class T>
+size_t SharedVector<T>::max_size() const {
+    return std::numeric_limits<size_t>::max() / sizeof(T);
+}
+
+template <class T>
+bool SharedVector<T>::empty() const {
+    return size_ == 0;
+}
+
+template <class T>
+T* SharedVector<T>::data() const {
+    return data_.get();
+}
+
+template <class T>
+T* SharedVector<T>::begin() const {
+    return data_.get();
+}
+
+template <class T>
+T* SharedVector<T>::end() const {
+    return data_.get() + size_;
+}
+
+template <class T>
+T& SharedVector<T>::operator[](size_t index) const {
+    return data_.get()[index];
+}
+
+template <class T>
+T& SharedVector<T>::at(size_t index) const {
+    if (index >= size_) {
+        throw std::out_of_range("SharedVector index out of range");
+    }
+    return data_.get()[index];
+}
+
+template <class T>
+void SharedVector<T>::reserve(size_t capacity) {
+    if (capacity <= capacity_) {
+        return;
+    }
+    if (capacity > max_size()) {
+        throw std::length_error("SharedVector capacity exceeds max_size()");
+    }
+
+    T* memory = static_cast<T*>(arena_->allocate(capacity * sizeof(T)));
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    if (size_ != 0) {
+        std::memcpy(memory, data_.get(), size_ * sizeof(T));
+    }
+    arena_->deallocate(data_.get());
+    data_ = memory;
+    capacity_ = capacity;
+}
+
+template <class T>
+void SharedVector<T>::resize(size_t size) {
+    if (size > capacity_) {
+        // Grows geometrically so that repeated appends stay amortized constant
+        reserve(std::max<size_t>(size, std::min<size_t>(capacity_ * 2, max_size())));
+    }
+    for (size_t i = size_; i < size; i++) {
+        new (data_.get() + i) T();
+    }
+    size_ = size;
+}
+
+template <class T>
+void SharedVector<T>::push_back(const T& element) {
+    if (size_ == capacity_) {
+        reserve(capacity_ == 0 ? 4 : std::min<size_t>(capacity_ * 2, max_size()));
+    }
+    data_.get()[size_++] = element;
+}
+
+template <class T>
+void SharedVector<T>::pop_back() {
+    if (size_ != 0) {
+        size_--;
+    }
+}
+
+template <class T>
+void SharedVector<T>::assign(const T* elements, size_t count) {
+    size_ = 0;
+    reserve(count);
+    if (count != 0) {
+        std::memcpy(data_.get(), elements, count * sizeof(T));
+    }
+    size_ = count;
+}
+
+template <class T>
+void SharedVector<T>::clear() {
+    size_ = 0;
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
@@ -0,0 +1,88 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "urf/common/containers/SharedObject.hpp"
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Bounded multi producer multi consumer queue of records living in a SharedObject segment, so
+ * that work items can move between processes. It mirrors ThreadSafeQueue: pop blocks until a
+ * record is available, push blocks while the queue is full, and dispose releases every waiter
+ * in every process. The queue state is protected by the SharedObject IPC lock and waiters
+ * sleep on its update notification.
+ *
+ * The state, disposal included, persists in the segment as long as it exists: reset() empties
+ * the queue and clears the disposal, so that a restarted set of processes can reuse the name.
+ */
+class URF_COMMON_EXPORT SharedWorkQueue {
+ public:
+    SharedWorkQueue(const std::string& name, uint32_t recordSize, uint32_t capacity);
+    SharedWorkQueue(const SharedWorkQueue&) = delete;
+    SharedWorkQueue(SharedWorkQueue&&) = delete;
+    ~SharedWorkQueue() = default;
+
+    bool push(const std::string& record);
+    bool push(const std::string& record, const std::chrono::milliseconds& timeout);
+
+    std::optional<std::string> pop();
+    std::optional<std::string> pop(const std::chrono::milliseconds& timeout);
+
+    size_t size();
+    void clear();
+    bool empty();
+    bool isDisposed();
+
+    void dispose();
+    void reset();
+
+    uint32_t recordSize() const;
+    uint32_t capacity() const;
+
+ private:
+    typedef struct {
+        uint32_t recordSize;
+        uint32_t capacity;
+        uint64_t head;
+        uint64_t tail;
+        uint32_t disposed;
+        uint32_t reserved;
+    } queue_header_t;
+
+    typedef struct {
+        uint32_t length;
+        uint32_t reserved;
+    } record_header_t;
+
+    using OptionalDeadline = std::optional<std::chrono::steady_clock::time_point>;
+
+    bool pushUntil(const std::string& record, const OptionalDeadline& deadline);
+    std::optional<std::string> popUntil(const OptionalDeadline& deadline);
+    bool waitForUpdate(uint32_t version, const OptionalDeadline& deadline);
+
+    static uint32_t recordStride(uint32_t recordSize);
+    record_header_t* recordAt(uint64_t index) const;
+
+ private:
+    SharedObject object_;
+    queue_header_t* header_;
+    uint32_t recordSize_;
+    uint32_t capacity_;
+    uint32_t recordStride_;
+};
+
+} // namespace containers
+} // namespace common
+} // namespace urf
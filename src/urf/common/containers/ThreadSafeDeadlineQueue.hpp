@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Blocking queue whose elements are scheduled at a point in time. Elements are popped in order
+ * of their scheduled time (FIFO for equal times) and only once that time has arrived, so pop()
+ * blocks also when the queue is not empty but its earliest element is not due yet.
+ */
+template <class T, class Clock = std::chrono::steady_clock>
+class ThreadSafeDeadlineQueue {
+ public:
+    using time_point = typename Clock::time_point;
+
+    ThreadSafeDeadlineQueue();
+    ThreadSafeDeadlineQueue(const ThreadSafeDeadlineQueue&);
+    ThreadSafeDeadlineQueue(ThreadSafeDeadlineQueue&&) = delete;
+    ~ThreadSafeDeadlineQueue() = default;
+
+    void push(const T& element, const time_point& scheduledAt);
+    void push(T&& element, const time_point& scheduledAt);
+
+    std::optional<T> pop();
+    std::optional<T> pop(const std::chrono::milliseconds& timeout);
+    std::optional<T> popUntil(const time_point& deadline);
+
+    std::optional<time_point> nextScheduledTime();
+
+    size_t size();
+    void clear();
+    bool empty();
+    bool isDisposed();
+
+    void notifyAll();
+    void dispose();
+
+    ThreadSafeDeadlineQueue& operator=(const ThreadSafeDeadlineQueue&);
+
+ private:
+    struct Entry {
+        time_point scheduledAt;
+        uint64_t sequence;
+        T element;
+    };
+
+    // Orders the heap so that the earliest (and, among equal times, the first pushed) is on top
+    struct EntryCompare {
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (a.scheduledAt != b.scheduledAt) {
+                return a.scheduledAt > b.scheduledAt;
+            }
+            return a.sequence > b.sequence;
+        }
+    };
+
+    void pushEntry(Entry&& entry);
+    std::optional<T> popDue(std::unique_lock<std::mutex>& lock,
+                            const std::optional<time_point>& deadline);
+
+ private:
+    std::vector<Entry> heap_;
+    uint64_t sequence_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+
+    bool notifySent_;
+    bool isDisposed_;
+};
+
+template <class T, class Clock>
+ThreadSafeDeadlineQueue<T, Clock>::ThreadSafeDeadlineQueue()
+    : heap_()
+    , sequence_(0)
+    , mtx_()
+    , cv_()
+    , notifySent_(false)
+    , isDisposed_(false) { }
+
+template <class T, class Clock>
+ThreadSafeDeadlineQueue<T, Clock>::ThreadSafeDeadlineQueue(const ThreadSafeDeadlineQueue& queue)
+    : heap_(queue.heap_)
+    , sequence_(queue.sequence_)
+    , mtx_()
+    , cv_()
+    , notifySent_(false)
+    , isDisposed_(false) { }
+
+template <class T, class Clock>
+void ThreadSafeDeadlineQueue<T, Clock>::push(const T& element, const time_point& scheduledAt) {
+    pushEntry(Entry{scheduledAt, 0, element});
+}
+
+template <class T, class Clock>
+void ThreadSafeDeadlineQueue<T, Clock>::push(T&& element, const time_point& scheduledAt) {
+    pushEntry(Entry{scheduledAt, 0, std::move(element)});
+}
+
+template <class T, class Clock>
+std::optional<T> ThreadSafeDeadlineQueue<T, Clock>::pop() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return popDue(lock, std::nullopt);
+}
+
+template <class T, class Clock>
+std::optional<T> ThreadSafeDeadlineQueue<T, Clock>::pop(const std::chrono::milliseconds& timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return popDue(lock, Clock::now() + timeout);
+}
+
+template <class T, class Clock>
+std::optional<T> ThreadSafeDeadlineQueue<T, Clock>::popUntil(const time_point& deadline) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return popDue(lock, deadline);
+}
+
+template <class T, class Clock>
+std::optional<typename ThreadSafeDeadlineQueue<T, Clock>::time_point>
+ThreadSafeDeadlineQueue<T, Clock>::nextScheduledTime() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_ || heap_.empty())
+        return std::nullopt;
+
+    return heap_.front().scheduledAt;
+}
+
+template <class T, class Clock>
+size_t ThreadSafeDeadlineQueue<T, Clock>::size() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return 0;
+
+    return heap_.size();
+}
+
+template <class T, class Clock>
+void ThreadSafeDeadlineQueue<T, Clock>::clear() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return;
+
+    heap_.clear();
+}
+
+template <class T, class Clock>
+bool ThreadSafeDeadlineQueue<T, Clock>::empty() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return true;
+
+    return heap_.empty();
+}
+
+template <class T, class Clock>
+void ThreadSafeDeadlineQueue<T, Clock>::notifyAll() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    notifySent_ = true;
+    cv_.notify_all();
+}
+
+template <class T, class Clock>
+void ThreadSafeDeadlineQueue<T, Clock>::dispose() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    isDisposed_ = true;
+    notifySent_ = true;
+    cv_.notify_all();
+}
+
+template <class T, class Clock>
+bool ThreadSafeDeadlineQueue<T, Clock>::isDisposed() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    return isDisposed_;
+}
+
+template <class T, class Clock>
+ThreadSafeDeadlineQueue<T, Clock>& ThreadSafeDeadlineQueue<T, Clock>::operator=(
+    const ThreadSafeDeadlineQueue<T, Clock>& queue) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    heap_ = queue.heap_;
+    sequence_ = queue.sequence_;
+    notifySent_ = false;
+    isDisposed_ = false;
+
+    return *this;
+}
+
+template <class T, class Clock>
+void ThreadSafeDeadlineQueue<T, Clock>::pushEntry(Entry&& entry) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return;
+
+    entry.sequence = sequence_++;
+    heap_.push_back(std::move(entry));
+    std::push_heap(heap_.begin(), heap_.end(), EntryCompare());
+    // A waiter might be sleeping until a later scheduled time, it has to re-evaluate its wake up
+    cv_.notify_all();
+}
+
+template <class T, class Clock>
+std::optional<T> ThreadSafeDeadlineQueue<T, Clock>::popDue(
+    std::unique_lock<std::mutex>& lock, const std::optional<time_point>& deadline) {
+    if (isDisposed_)
+        return std::nullopt;
+
+    notifySent_ = false;
+    while (true) {
+        if (notifySent_) {
+            return std::nullopt;
+        }
+
+        auto now = Clock::now();
+        if (!heap_.empty() && (heap_.front().scheduledAt <= now)) {
+            std::pop_heap(heap_.begin(), heap_.end(), EntryCompare());
+            T elem = std::move(heap_.back().element);
+            heap_.pop_back();
+            return elem;
+        }
+
+        if (deadline && (now >= *deadline)) {
+            return std::nullopt;
+        }
+
+        if (heap_.empty() && !deadline) {
+            cv_.wait(lock);
+        } else if (heap_.empty()) {
+            cv_.wait_until(lock, *deadline);
+        } else if (!deadline || (heap_.front().scheduledAt < *deadline)) {
+            cv_.wait_until(lock, heap_.front().scheduledAt);
+        } else {
+            cv_.wait_until(lock, *deadline);
+        }
+    }
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
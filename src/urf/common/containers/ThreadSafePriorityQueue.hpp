@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace urf {
+namespace common {
+namespace containers {
+
+/**
+ * Blocking queue that pops the element with the highest priority according to Compare
+ * (std::less pops the greatest element first, as std::priority_queue does). It offers the same
+ * pop/notifyAll/dispose semantics of ThreadSafeQueue.
+ */
+template <class T, class Compare = std::less<T>>
+class ThreadSafePriorityQueue {
+ public:
+    ThreadSafePriorityQueue();
+    explicit ThreadSafePriorityQueue(const Compare& compare);
+    ThreadSafePriorityQueue(const ThreadSafePriorityQueue&);
+    ThreadSafePriorityQueue(ThreadSafePriorityQueue&&) = delete;
+    ~ThreadSafePriorityQueue() = default;
+
+    void push(const T& element);
+    void push(T&& element);
+
+    std::optional<T> pop();
+    std::optional<T> pop(const std::chrono::milliseconds& timeout);
+
+    size_t size();
+    void clear();
+    bool empty();
+    bool isDisposed();
+
+    void notifyAll();
+    void dispose();
+
+    ThreadSafePriorityQueue& operator=(const ThreadSafePriorityQueue&);
+
+ private:
+    T popTop();
+
+ private:
+    std::vector<T> heap_;
+    Compare compare_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+
+    bool notifySent_;
+    bool isDisposed_;
+};
+
+template <class T, class Compare>
+ThreadSafePriorityQueue<T, Compare>::ThreadSafePriorityQueue()
+    : heap_()
+    , compare_()
+    , mtx_()
+    , cv_()
+    , notifySent_(false)
+    , isDisposed_(false) { }
+
+template <class T, class Compare>
+ThreadSafePriorityQueue<T, Compare>::ThreadSafePriorityQueue(const Compare& compare)
+    : heap_()
+    , compare_(compare)
+    , mtx_()
+    , cv_()
+    , notifySent_(false)
+    , isDisposed_(false) { }
+
+template <class T, class Compare>
+ThreadSafePriorityQueue<T, Compare>::ThreadSafePriorityQueue(const ThreadSafePriorityQueue& queue)
+    : heap_(queue.heap_)
+    , compare_(queue.compare_)
+    , mtx_()
+    , cv_()
+    , notifySent_(false)
+    , isDisposed_(false) { }
+
+template <class T, class Compare>
+void ThreadSafePriorityQueue<T, Compare>::push(const T& element) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return;
+
+    heap_.push_back(element);
+    std::push_heap(heap_.begin(), heap_.end(), compare_);
+    cv_.notify_one();
+}
+
+template <class T, class Compare>
+void ThreadSafePriorityQueue<T, Compare>::push(T&& element) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return;
+
+    heap_.push_back(std::move(element));
+    std::push_heap(heap_.begin(), heap_.end(), compare_);
+    cv_.notify_one();
+}
+
+template <class T, class Compare>
+std::optional<T> ThreadSafePriorityQueue<T, Compare>::pop() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (isDisposed_)
+        return std::nullopt;
+
+    notifySent_ = false;
+    if (heap_.empty()) {
+        cv_.wait(lock, [this]() { return (!heap_.empty() || notifySent_); });
+    }
+
+    if (notifySent_) {
+        return std::nullopt;
+    }
+
+    if (heap_.empty()) {
+        return std::nullopt;
+    }
+
+    return popTop();
+}
+
+template <class T, class Compare>
+std::optional<T> ThreadSafePriorityQueue<T, Compare>::pop(
+    const std::chrono::milliseconds& timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (isDisposed_)
+        return std::nullopt;
+
+    notifySent_ = false;
+    if (heap_.empty() &&
+        !cv_.wait_for(lock, timeout, [this]() { return (!heap_.empty() || notifySent_); })) {
+        return std::nullopt;
+    }
+
+    if (notifySent_) {
+        return std::nullopt;
+    }
+
+    return popTop();
+}
+
+template <class T, class Compare>
+size_t ThreadSafePriorityQueue<T, Compare>::size() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return 0;
+
+    return heap_.size();
+}
+
+template <class T, class Compare>
+void ThreadSafePriorityQueue<T, Compare>::clear() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return;
+
+    heap_.clear();
+}
+
+template <class T, class Compare>
+bool ThreadSafePriorityQueue<T, Compare>::empty() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (isDisposed_)
+        return true;
+
+    return heap_.empty();
+}
+
+template <class T, class Compare>
+void ThreadSafePriorityQueue<T, Compare>::notifyAll() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    notifySent_ = true;
+    cv_.notify_all();
+}
+
+template <class T, class Compare>
+void ThreadSafePriorityQueue<T, Compare>::dispose() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    isDisposed_ = true;
+    notifySent_ = true;
+    cv_.notify_all();
+}
+
+template <class T, class Compare>
+bool ThreadSafePriorityQueue<T, Compare>::isDisposed() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    return isDisposed_;
+}
+
+template <class T, class Compare>
+ThreadSafePriorityQueue<T, Compare>& ThreadSafePriorityQueue<T, Compare>::operator=(
+    const ThreadSafePriorityQueue<T, Compare>& queue) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    heap_ = queue.heap_;
+    compare_ = queue.compare_;
+    notifySent_ = false;
+    isDisposed_ = false;
+
+    return *this;
+}
+
+template <class T, class Compare>
+T ThreadSafePriorityQueue<T, Compare>::popTop() {
+    std::pop_heap(heap_.begin(), heap_.end(), compare_);
+    T elem = std::move(heap_.back());
+    heap_.pop_back();
+    return elem;
+}
+
+} // namespace containers
+} // namespace common
+} // namespace urf
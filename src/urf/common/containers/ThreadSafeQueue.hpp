@@ -1,22 +1,40 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <stdexcept>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#include "urf/common/containers/QueueSignal.hpp"
+#include "urf/common/containers/QueueStatistics.hpp"
 
 namespace urf {
 namespace common {
 namespace containers {
 
-template <class T>
+/**
+ * FIFO blocking queue. The Statistics policy (see QueueStatistics.hpp) can be used to instrument
+ * the queue, by default it is disabled at no cost.
+ */
+template <class T, class Statistics = NoQueueStatistics>
 class ThreadSafeQueue {
  public:
     ThreadSafeQueue();
     ThreadSafeQueue(const ThreadSafeQueue&);
     ThreadSafeQueue(ThreadSafeQueue&&) = delete;
-    ~ThreadSafeQueue() = default;
+    ~ThreadSafeQueue();
 
     void push(const T& element);
     void push(T&& element);
@@ -29,57 +47,115 @@ class ThreadSafeQueue {
     bool empty();
     bool isDisposed();
 
+    QueueStatisticsSnapshot statistics();
+    void resetStatistics();
+
     void notifyAll();
     void dispose();
 
+    // Signals are notified on every push, notifyAll and dispose (see QueueSelector)
+    void attach(const std::shared_ptr<QueueSignal>& signal);
+    void detach(const std::shared_ptr<QueueSignal>& signal);
+
+#ifdef __linux__
+    /**
+     * Returns an eventfd that is readable while the queue is not empty, so that the queue can be
+     * multiplexed in a poll/epoll loop together with sockets and timers. The descriptor is
+     * created on the first call and owned by the queue: it must not be read or closed by the
+     * caller, elements are taken with pop(std::chrono::milliseconds(0)) once it is readable.
+     */
+    int eventFd();
+#endif
+
     ThreadSafeQueue& operator=(const ThreadSafeQueue&);
 
  private:
     std::queue<T> queue_;
     std::mutex mtx_;
     std::condition_variable cv_;
+    std::vector<std::shared_ptr<QueueSignal>> signals_;
+    [[no_unique_address]] Statistics statistics_;
 
     bool notifySent_;
     bool isDisposed_;
+
+#ifdef __linux__
+    int eventFd_;
+    bool eventFdReadable_;
+#endif
+
+    void notifySignals();
+    void updateEventFd();
 };
 
-template <class T>
-ThreadSafeQueue<T>::ThreadSafeQueue()
+template <class T, class Statistics>
+ThreadSafeQueue<T, Statistics>::ThreadSafeQueue()
     : queue_()
     , mtx_()
     , cv_()
+    , signals_()
+    , statistics_()
     , notifySent_(false)
-    , isDisposed_(false) { }
-template <class T>
-ThreadSafeQueue<T>::ThreadSafeQueue(const ThreadSafeQueue& queue)
+    , isDisposed_(false)
+#ifdef __linux__
+    , eventFd_(-1)
+    , eventFdReadable_(false)
+#endif
+{ }
+template <class T, class Statistics>
+ThreadSafeQueue<T, Statistics>::ThreadSafeQueue(const ThreadSafeQueue& queue)
     : queue_(queue.queue_)
     , mtx_()
     , cv_()
+    , signals_()
+    , statistics_()
     , notifySent_(false)
-    , isDisposed_(false) { }
+    , isDisposed_(false)
+#ifdef __linux__
+    , eventFd_(-1)
+    , eventFdReadable_(false)
+#endif
+{
+    statistics_.onAssign(queue_.size());
+}
 
-template <class T>
-void ThreadSafeQueue<T>::push(const T& element) {
+template <class T, class Statistics>
+ThreadSafeQueue<T, Statistics>::~ThreadSafeQueue() {
+#ifdef __linux__
+    if (eventFd_ != -1) {
+        ::close(eventFd_);
+    }
+#endif
+}
+
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::push(const T& element) {
     std::scoped_lock<std::mutex> guard(mtx_);
     if (isDisposed_)
         return;
 
     queue_.push(element);
+    statistics_.onPush(queue_.size());
     cv_.notify_one();
+    notifySignals();
+    updateEventFd();
 }
 
-template <class T>
-void ThreadSafeQueue<T>::push(T&& element) {
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::push(T&& element) {
     std::scoped_lock<std::mutex> guard(mtx_);
     if (isDisposed_)
         return;
 
     queue_.emplace(element);
+    statistics_.onPush(queue_.size());
     cv_.notify_one();
+    notifySignals();
+    updateEventFd();
 }
 
-template <class T>
-std::optional<T> ThreadSafeQueue<T>::pop() {
+template <class T, class Statistics>
+std::optional<T> ThreadSafeQueue<T, Statistics>::pop() {
     std::unique_lock<std::mutex> lock(mtx_);
     if (isDisposed_)
         return std::nullopt;
@@ -99,11 +175,13 @@ std::optional<T> ThreadSafeQueue<T>::pop() {
 
     T elem = queue_.front();
     queue_.pop();
+    statistics_.onPop(queue_.size());
+    updateEventFd();
     return elem;
 }
 
-template <class T>
-std::optional<T> ThreadSafeQueue<T>::pop(const std::chrono::milliseconds& timeout) {
+template <class T, class Statistics>
+std::optional<T> ThreadSafeQueue<T, Statistics>::pop(const std::chrono::milliseconds& timeout) {
     std::unique_lock<std::mutex> lock(mtx_);
     if (isDisposed_)
         return std::nullopt;
@@ -120,11 +198,13 @@ std::optional<T> ThreadSafeQueue<T>::pop(const std::chrono::milliseconds& timeou
 
     T elem = queue_.front();
     queue_.pop();
+    statistics_.onPop(queue_.size());
+    updateEventFd();
     return elem;
 }
 
-template <class T>
-size_t ThreadSafeQueue<T>::size() {
+template <class T, class Statistics>
+size_t ThreadSafeQueue<T, Statistics>::size() {
     std::scoped_lock<std::mutex> guard(mtx_);
     if (isDisposed_)
         return 0;
@@ -132,18 +212,20 @@ size_t ThreadSafeQueue<T>::size() {
     return queue_.size();
 }
 
-template <class T>
-void ThreadSafeQueue<T>::clear() {
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::clear() {
     std::scoped_lock<std::mutex> guard(mtx_);
     if (isDisposed_)
         return;
 
     while (!queue_.empty())
         queue_.pop();
+    statistics_.onAssign(0);
+    updateEventFd();
 }
 
-template <class T>
-bool ThreadSafeQueue<T>::empty() {
+template <class T, class Statistics>
+bool ThreadSafeQueue<T, Statistics>::empty() {
     std::scoped_lock<std::mutex> guard(mtx_);
     if (isDisposed_)
         return true;
@@ -151,37 +233,110 @@ bool ThreadSafeQueue<T>::empty() {
     return queue_.empty();
 }
 
-template <class T>
-void ThreadSafeQueue<T>::notifyAll() {
+template <class T, class Statistics>
+QueueStatisticsSnapshot ThreadSafeQueue<T, Statistics>::statistics() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    return statistics_.snapshot();
+}
+
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::resetStatistics() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    statistics_.reset(queue_.size());
+}
+
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::notifyAll() {
     std::scoped_lock<std::mutex> guard(mtx_);
     notifySent_ = true;
     cv_.notify_all();
+    notifySignals();
 }
 
-template <class T>
-void ThreadSafeQueue<T>::dispose() {
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::dispose() {
     std::scoped_lock<std::mutex> guard(mtx_);
     isDisposed_ = true;
     notifySent_ = true;
     cv_.notify_all();
+    notifySignals();
+    updateEventFd();
 }
 
-template <class T>
-bool ThreadSafeQueue<T>::isDisposed() {
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::attach(const std::shared_ptr<QueueSignal>& signal) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    signals_.push_back(signal);
+}
+
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::detach(const std::shared_ptr<QueueSignal>& signal) {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    signals_.erase(std::remove(signals_.begin(), signals_.end(), signal), signals_.end());
+}
+
+template <class T, class Statistics>
+bool ThreadSafeQueue<T, Statistics>::isDisposed() {
     std::scoped_lock<std::mutex> guard(mtx_);
     return isDisposed_;
 }
 
-template <class T>
-ThreadSafeQueue<T>& ThreadSafeQueue<T>::operator=(const ThreadSafeQueue<T>& queue) {
+template <class T, class Statistics>
+ThreadSafeQueue<T, Statistics>&
+ThreadSafeQueue<T, Statistics>::operator=(const ThreadSafeQueue<T, Statistics>& queue) {
     std::scoped_lock<std::mutex> guard(mtx_);
     queue_ = queue.queue_;
     notifySent_ = false;
     isDisposed_ = false;
+    statistics_.onAssign(queue_.size());
+    updateEventFd();
 
     return *this;
 }
 
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::notifySignals() {
+    for (auto& signal : signals_) {
+        signal->notify();
+    }
+}
+
+#ifdef __linux__
+template <class T, class Statistics>
+int ThreadSafeQueue<T, Statistics>::eventFd() {
+    std::scoped_lock<std::mutex> guard(mtx_);
+    if (eventFd_ == -1) {
+        eventFd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (eventFd_ == -1) {
+            throw std::runtime_error(std::strerror(errno));
+        }
+        updateEventFd();
+    }
+
+    return eventFd_;
+}
+#endif
+
+template <class T, class Statistics>
+void ThreadSafeQueue<T, Statistics>::updateEventFd() {
+#ifdef __linux__
+    // The eventfd is only touched when the queue goes from empty to non empty and back
+    if (eventFd_ == -1) {
+        return;
+    }
+
+    bool hasElements = !isDisposed_ && !queue_.empty();
+    if (hasElements && !eventFdReadable_) {
+        eventfd_write(eventFd_, 1);
+        eventFdReadable_ = true;
+    } else if (!hasElements && eventFdReadable_) {
+        eventfd_t value;
+        eventfd_read(eventFd_, &value);
+        eventFdReadable_ = false;
+    }
+#endif
+}
+
 } // namespace containers
 } // namespace common
 } // namespace urf
@@ -0,0 +1,191 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "urf/common/events/events.hpp"
+
+namespace urf {
+namespace common {
+namespace events {
+
+using topic_id = uint64_t;
+
+// FNV-1a hash of a topic name, usable at compile time
+constexpr topic_id hashTopic(std::string_view name) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * Typed handle of a topic registered in an event_bus, valid as long as the bus. Publishing
+ * through it skips the routing table and checks the arguments at compile time.
+ */
+template <typename... Args>
+class topic {
+ public:
+    topic_id id() const;
+
+ private:
+    friend class event_bus;
+    topic(topic_id id, event<Args...>* topicEvent);
+
+    topic_id _id;
+    event<Args...>* _event;
+};
+
+/**
+ * Topic based publish/subscribe between components that don't know each other. Every topic is an
+ * event<Args...> registered under the hash of its name: the string work is done once, at
+ * registration. publish() is then either a direct call through the typed topic handle returned
+ * at registration, or an integer lookup in a copy-on-write routing table. Publishers never take
+ * the bus mutex, only the std::atomic_load of the table pointer, which is not lock-free in
+ * libstdc++. Prefix subscriptions are resolved when either side registers.
+ *
+ * The arguments of a topic are fixed by its first registration or subscription, using it with
+ * other arguments throws std::invalid_argument. The arguments of publish() are never deduced
+ * from the call: they come from the topic handle, or must be given explicitly with a topic_id,
+ * so that publish<std::string>(id, "literal") converts instead of failing. Topics are never
+ * removed.
+ */
+class URF_COMMON_EXPORT event_bus {
+ public:
+    // Keeps Args out of deduction so that lambdas convert, e.g. subscribe<int>("topic", lambda)
+    template <typename... Args>
+    using callback_t = typename std::common_type<std::function<void(const Args&...)>>::type;
+    template <typename T>
+    using argument_t = typename std::common_type<T>::type;
+
+    // Process-wide bus
+    static event_bus& instance();
+
+    event_bus();
+    event_bus(const event_bus&) = delete;
+    event_bus(event_bus&&) = delete;
+    ~event_bus() = default;
+
+    template <typename... Args>
+    topic<Args...> registerTopic(const std::string& name);
+    template <typename... Args>
+    void publish(const topic<Args...>& handle, const argument_t<Args>&... args);
+    // Returns false when nobody registered or subscribed to the topic
+    template <typename... Args>
+    bool publish(topic_id id, const argument_t<Args>&... args);
+
+    template <typename... Args>
+    topic<Args...> subscribe(const std::string& name,
+                             const callback_t<Args...>& callback,
+                             event_policy policy = event_policy::asynchronous);
+    // Subscribes to every topic, present or future, whose name starts with prefix and has Args
+    template <typename... Args>
+    void subscribePrefix(const std::string& prefix,
+                         const callback_t<Args...>& callback,
+                         event_policy policy = event_policy::asynchronous);
+
+    std::vector<std::string> topics() const;
+
+    event_bus& operator=(const event_bus&) = delete;
+    event_bus& operator=(event_bus&&) = delete;
+
+ private:
+    struct route {
+        std::string name;
+        std::type_index type;
+        std::shared_ptr<event_base> event;
+    };
+    using routing_table = std::unordered_map<topic_id, route>;
+
+    struct prefix_subscription {
+        std::string prefix;
+        std::type_index type;
+        std::function<void(event_base&)> subscribe;
+    };
+
+    // Creates the topic event with factory if needed
+    event_base& findOrCreate(const std::string& name,
+                             const std::type_index& type,
+                             const std::function<std::shared_ptr<event_base>()>& factory);
+    void addPrefixSubscription(prefix_subscription&& subscription);
+    event_base* find(topic_id id, const std::type_index& type) const;
+
+ private:
+    // Serializes the writers of _routes, publishers only load it with std::atomic_load
+    mutable std::mutex _mutex;
+    std::shared_ptr<const routing_table> _routes;
+    std::vector<prefix_subscription> _prefixSubscriptions;
+};
+
+template <typename... Args>
+topic<Args...>::topic(topic_id id, event<Args...>* topicEvent)
+    : _id(id)
+    , _event(topicEvent) { }
+
+template <typename... Args>
+topic_id topic<Args...>::id() const {
+    return _id;
+}
+
+template <typename... Args>
+topic<Args...> event_bus::registerTopic(const std::string& name) {
+    auto& topicEvent = static_cast<event<Args...>&>(findOrCreate(
+        name, typeid(event<Args...>), []() { return std::make_shared<event<Args...>>(); }));
+    return topic<Args...>(hashTopic(name), &topicEvent);
+}
+
+template <typename... Args>
+void event_bus::publish(const topic<Args...>& handle, const argument_t<Args>&... args) {
+    handle._event->emit(args...);
+}
+
+template <typename... Args>
+bool event_bus::publish(topic_id id, const argument_t<Args>&... args) {
+    auto topicEvent = static_cast<event<Args...>*>(find(id, typeid(event<Args...>)));
+    if (topicEvent == nullptr) {
+        return false;
+    }
+
+    topicEvent->emit(args...);
+    return true;
+}
+
+template <typename... Args>
+topic<Args...> event_bus::subscribe(const std::string& name,
+                                    const callback_t<Args...>& callback,
+                                    event_policy policy) {
+    auto& topicEvent = static_cast<event<Args...>&>(findOrCreate(
+        name, typeid(event<Args...>), []() { return std::make_shared<event<Args...>>(); }));
+    topicEvent.subscribe(callback, policy);
+    return topic<Args...>(hashTopic(name), &topicEvent);
+}
+
+template <typename... Args>
+void event_bus::subscribePrefix(const std::string& prefix,
+                                const callback_t<Args...>& callback,
+                                event_policy policy) {
+    addPrefixSubscription({prefix, typeid(event<Args...>), [callback, policy](event_base& base) {
+                               static_cast<event<Args...>&>(base).subscribe(callback, policy);
+                           }});
+}
+
+} // namespace events
+} // namespace common
+} // namespace urf
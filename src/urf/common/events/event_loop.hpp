@@ -0,0 +1,56 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <chrono>
+#include <functional>
+
+#include "urf/common/containers/ThreadSafeQueue.hpp"
+
+namespace urf {
+namespace common {
+namespace events {
+
+/**
+ * Queue of callback invocations owned by a consumer thread, such as a control loop. Events post
+ * the callbacks of their event_policy::queued subscribers here, and the owning thread runs them
+ * when it calls processEvents(): callbacks then need no locking against the rest of the loop and
+ * run at a deterministic point of its cycle.
+ */
+class URF_COMMON_EXPORT event_loop {
+ public:
+    event_loop() = default;
+    event_loop(const event_loop&) = delete;
+    event_loop(event_loop&&) = delete;
+    ~event_loop() = default;
+
+    void post(std::function<void()> task);
+
+    /**
+     * Runs the callbacks queued so far and returns how many ran. Callbacks posted meanwhile are
+     * left for the next call, so that a callback emitting again can't starve the loop.
+     */
+    size_t processEvents();
+    // Same as above, first waiting up to timeout for a callback when none is queued
+    size_t processEvents(const std::chrono::milliseconds& timeout);
+
+    size_t pending();
+    // Wakes up a processEvents call waiting for callbacks
+    void notifyAll();
+
+#ifdef __linux__
+    // Readable while callbacks are queued, see ThreadSafeQueue::eventFd()
+    int eventFd();
+#endif
+
+ private:
+    containers::ThreadSafeQueue<std::function<void()>> tasks_;
+};
+
+} // namespace events
+} // namespace common
+} // namespace urf
@@ -0,0 +1,64 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "urf/common/statistics/LatencyHistogram.hpp"
+
+namespace urf {
+namespace common {
+namespace events {
+
+struct subscriber_trace {
+    std::string event;
+    // Position of the subscriber in the event subscription order
+    size_t subscriber;
+    // Time from emit() to the callback start
+    statistics::LatencyHistogram queueDelay;
+    statistics::LatencyHistogram callbackDuration;
+};
+
+/**
+ * Delivery timings of a traced event (see event::enableTracing). Every living trace is listed in
+ * a process-wide registry, so that snapshotAll() shows which listeners cause backlog.
+ */
+class URF_COMMON_EXPORT event_trace {
+ public:
+    static std::shared_ptr<event_trace> create(const std::string& name);
+
+    event_trace(const event_trace&) = delete;
+    event_trace(event_trace&&) = delete;
+    ~event_trace() = default;
+
+    const std::string& name() const;
+
+    void record(size_t subscriber,
+                const std::chrono::nanoseconds& queueDelay,
+                const std::chrono::nanoseconds& callbackDuration);
+    std::vector<subscriber_trace> snapshot() const;
+    void reset();
+
+    static std::vector<subscriber_trace> snapshotAll();
+    static void resetAll();
+
+ private:
+    explicit event_trace(const std::string& name);
+
+ private:
+    std::string _name;
+    mutable std::mutex _mutex;
+    std::vector<subscriber_trace> _subscribers;
+};
+
+} // namespace events
+} // namespace common
+} // namespace urf
@@ -1,45 +1,199 @@
 #pragma once
 
+#include "urf/common/events/event_loop.hpp"
+#include "urf/common/events/event_trace.hpp"
+#include "urf/common/threading/Strand.hpp"
 #include "urf/common/threading/ThreadPool.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace urf {
 namespace common {
 namespace events {
 
-enum class event_policy { synchronous, asynchronous };
+/**
+ * synchronous callbacks run in emit(), asynchronous ones on the dispatch pool and queued ones on
+ * the thread owning the event_loop given at subscription, when it processes its events.
+ */
+enum class event_policy { synchronous, asynchronous, queued };
+
+/**
+ * per_subscriber queues a pool task for every asynchronous subscriber, which then run in
+ * parallel. per_emit queues a single task invoking all the asynchronous subscribers in
+ * sequence, and consecutive emits pending on it are run in the same pool task: high fan-out
+ * events then cost O(1) queue operations per emit.
+ */
+enum class dispatch_mode { per_subscriber, per_emit };
+
+/**
+ * Delivery policy of an asynchronous subscription, bounding the load of slow consumers without
+ * changing the emitter. latestOnly collapses the emits still pending for the subscriber into the
+ * latest one. minInterval throttles the deliveries: an emit arriving sooner after the previous
+ * delivery is collapsed too, and with trailingEdge the latest of them is delivered once the
+ * interval elapsed, otherwise it is dropped.
+ *
+ * Other subscriptions queue their pending emits in a mailbox, bounded by mailboxCapacity when not
+ * 0: once full, overflow drops the oldest pending emit, drops the new one or blocks the emitter
+ * until the subscriber catches up. Blocking is only done on emitter threads: an emit made from a
+ * dispatch pool thread, e.g. by another asynchronous callback, could wait for the very thread
+ * that has to drain the mailbox, so it falls back to dropping the new emit.
+ */
+enum class overflow_policy { drop_oldest, drop_newest, block };
+
+struct delivery_policy {
+    bool latestOnly = false;
+    std::chrono::milliseconds minInterval = std::chrono::milliseconds(0);
+    bool trailingEdge = true;
+    size_t mailboxCapacity = 0;
+    overflow_policy overflow = overflow_policy::drop_oldest;
+};
 
 class event_base {
  public:
     virtual ~event_base() = default;
 
+    /**
+     * Number of threads running the asynchronous callbacks of all events, 1 by default. The
+     * callbacks of a subscriber still run one at a time and in emit order. Changing it waits for
+     * the running callbacks, so it must not be done from a callback.
+     */
+    static void setDispatchThreads(threading::concurrency_t count);
+    static threading::concurrency_t dispatchThreads();
+
  protected:
+    // Runs the task on a timer thread once the given time is reached
+    static void scheduleAt(const std::chrono::steady_clock::time_point& time,
+                           std::function<void()> task);
+
     static threading::ThreadPool _threadPool;
 };
 
+/**
+ * Subscribers are stored in an immutable list, replaced by a new copy on every subscription
+ * (copy-on-write). emit() never holds the event mutex: it only takes a reference to the current
+ * list with std::atomic_load, which is not lock-free (libstdc++ guards the pointer copy with an
+ * internal mutex pool), then runs the callbacks on that list without any lock. Emits from
+ * different threads therefore only contend for that pointer copy, and callbacks can emit or
+ * subscribe without deadlocking. A subscription made while an emit is running is only seen by
+ * later emits.
+ *
+ * Callbacks receive the arguments by const reference: asynchronous subscribers of an emit all
+ * read the same reference counted copy of the arguments, made once per emit.
+ *
+ * Subscribers with a delivery policy are always dispatched on their own, whatever the dispatch
+ * mode of the event.
+ *
+ * Tracing is disabled by default and then costs a single shared_ptr atomic load per emit.
+ */
 template <typename... Args>
 class event : public event_base {
  public:
     event() = default;
+    explicit event(dispatch_mode mode);
     event(const event&);
     event(event&&) noexcept;
     ~event() override;
 
     void emit(const Args&... args);
-    void subscribe(const std::function<void(Args...)>& callback,
+    void subscribe(const std::function<void(const Args&...)>& callback,
                    event_policy policy = event_policy::asynchronous);
+    // Asynchronous subscription delivered according to the given policy
+    void subscribe(const std::function<void(const Args&...)>& callback,
+                   const delivery_policy& delivery);
+    // Queued subscription, the loop must outlive the event
+    void subscribe(const std::function<void(const Args&...)>& callback, event_loop& loop);
+
+    dispatch_mode dispatchMode() const noexcept;
+
+    // Emits never delivered to the subscribers with a delivery policy, collapsed ones included
+    uint64_t dropped() const;
+
+    // Records the queue delay and callback duration of every subscriber under the given name.
+    // Moves transfer the trace, copies start untraced
+    void enableTracing(const std::string& name);
+    void disableTracing();
+    std::shared_ptr<event_trace> trace() const;
 
     explicit operator bool() const noexcept;
-    void operator+=(const std::function<void(Args...)>& callback);
+    void operator+=(const std::function<void(const Args&...)>& callback);
 
     event& operator=(const event&);
     event& operator=(event&&) noexcept;
 
  private:
+    // Arguments of an emit, shared by all its deferred deliveries
+    struct emitted {
+        emitted(const Args&... values,
+                const std::shared_ptr<event_trace>& emitTrace,
+                const std::chrono::steady_clock::time_point& emitTime)
+            : args(values...)
+            , trace(emitTrace)
+            , time(emitTime) { }
+
+        std::tuple<Args...> args;
+        // Only set when tracing
+        std::shared_ptr<event_trace> trace;
+        std::chrono::steady_clock::time_point time;
+    };
+    using payload_ptr = std::shared_ptr<const emitted>;
+
+    struct delivery_state {
+        std::mutex mtx;
+        std::condition_variable cv;
+        // Emits not delivered yet, at most one when coalescing
+        std::deque<payload_ptr> pending;
+        bool scheduled = false;
+        std::chrono::steady_clock::time_point lastDelivery;
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    struct subscriber {
+        std::function<void(const Args&...)> callback;
+        event_policy policy;
+        // Serializes the asynchronous callbacks of the subscriber on the shared pool
+        std::shared_ptr<threading::Strand> strand;
+        delivery_policy delivery;
+        // Only for subscriptions with a delivery policy
+        std::shared_ptr<delivery_state> state;
+        // Only for queued subscriptions
+        event_loop* loop;
+        size_t index = 0;
+    };
+    using subscriber_list = std::vector<subscriber>;
+
+    void addSubscriber(subscriber&& entry);
+    static void invoke(const subscriber& entry, const emitted& payload);
+    static void deliver(const std::shared_ptr<const subscriber_list>& callbacks,
+                        const subscriber& entry,
+                        const payload_ptr& payload);
+    static void coalesce(const std::shared_ptr<const subscriber_list>& callbacks,
+                         const subscriber& entry,
+                         const payload_ptr& payload);
+    static void enqueue(const std::shared_ptr<const subscriber_list>& callbacks,
+                        const subscriber& entry,
+                        const payload_ptr& payload);
+    static void drainMailbox(const std::shared_ptr<const subscriber_list>& callbacks,
+                             const subscriber& entry);
+
+    // Serializes the writers of _callbacks, readers only use std::atomic_load
     mutable std::mutex _mutex;
-    std::vector<std::tuple<std::function<void(Args...)>, event_policy>> _callbacks;
+    std::shared_ptr<const subscriber_list> _callbacks;
+
+    dispatch_mode _dispatchMode = dispatch_mode::per_subscriber;
+    // Runs the per_emit dispatch tasks in emit order
+    std::shared_ptr<threading::Strand> _strand;
+
+    std::shared_ptr<event_trace> _trace;
 };
 
 template <typename... Args>
@@ -48,60 +202,336 @@ event<Args...>::~event() {
 }
 
 template <typename... Args>
-event<Args...>::event(const event& other) {
-    std::lock_guard<std::mutex> lock(other._mutex);
-    _callbacks = other._callbacks;
+event<Args...>::event(dispatch_mode mode)
+    : _dispatchMode(mode)
+    , _strand(mode == dispatch_mode::per_emit ? std::make_shared<threading::Strand>(_threadPool)
+                                              : nullptr) { }
+
+template <typename... Args>
+event<Args...>::event(const event& other)
+    : event(other._dispatchMode) {
+    _callbacks = std::atomic_load(&other._callbacks);
 }
 
 template <typename... Args>
 event<Args...>::event(event&& other) noexcept {
     std::lock_guard<std::mutex> lock(other._mutex);
-    _callbacks = std::move(other._callbacks);
+    _callbacks = std::atomic_exchange(&other._callbacks, std::shared_ptr<const subscriber_list>());
+    _dispatchMode = other._dispatchMode;
+    _strand = other._strand;
+    _trace = std::atomic_exchange(&other._trace, std::shared_ptr<event_trace>());
 }
 
 template <typename... Args>
 void event<Args...>::emit(const Args&... args) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    for (auto& callback : _callbacks) {
-        if (std::get<1>(callback) == event_policy::synchronous) {
-            std::get<0>(callback)(args...);
+    auto callbacks = std::atomic_load(&_callbacks);
+    if (!callbacks) {
+        return;
+    }
+
+    auto trace = std::atomic_load(&_trace);
+    std::chrono::steady_clock::time_point emitTime;
+    if (trace) {
+        emitTime = std::chrono::steady_clock::now();
+    }
+
+    // Asynchronous subscribers share a single immutable copy of the arguments
+    payload_ptr payload;
+    bool pendingPerEmit = false;
+    for (auto& subscriber : *callbacks) {
+        if (subscriber.policy == event_policy::synchronous) {
+            if (!trace) {
+                subscriber.callback(args...);
+                continue;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            subscriber.callback(args...);
+            trace->record(
+                subscriber.index, start - emitTime, std::chrono::steady_clock::now() - start);
+            continue;
+        }
+
+        if (!payload) {
+            payload = std::make_shared<const emitted>(args..., trace, emitTime);
+        }
+        if (subscriber.policy == event_policy::queued) {
+            subscriber.loop->post(
+                [callbacks, &subscriber, payload]() { invoke(subscriber, *payload); });
+        } else if (subscriber.state) {
+            deliver(callbacks, subscriber, payload);
+        } else if (_dispatchMode == dispatch_mode::per_emit) {
+            pendingPerEmit = true;
         } else {
-            _threadPool.pushTask(std::get<0>(callback), args...);
+            // The list snapshot keeps the subscriber alive until its callback ran
+            subscriber.strand->post(
+                [callbacks, &subscriber, payload]() { invoke(subscriber, *payload); });
+        }
+    }
+
+    if (pendingPerEmit) {
+        _strand->post([callbacks, payload]() {
+            for (auto& subscriber : *callbacks) {
+                if ((subscriber.policy == event_policy::asynchronous) && !subscriber.state) {
+                    invoke(subscriber, *payload);
+                }
+            }
+        });
+    }
+}
+
+template <typename... Args>
+void event<Args...>::subscribe(const std::function<void(const Args&...)>& callback,
+                               event_policy policy) {
+    if (policy == event_policy::queued) {
+        throw std::invalid_argument("Queued subscriptions need the event_loop to post to");
+    }
+
+    addSubscriber({callback,
+                   policy,
+                   policy == event_policy::asynchronous
+                       ? std::make_shared<threading::Strand>(_threadPool)
+                       : nullptr,
+                   delivery_policy(),
+                   nullptr,
+                   nullptr});
+}
+
+template <typename... Args>
+void event<Args...>::subscribe(const std::function<void(const Args&...)>& callback,
+                               const delivery_policy& delivery) {
+    if (delivery.minInterval.count() < 0) {
+        throw std::invalid_argument("The minimum delivery interval can't be negative");
+    }
+
+    bool limited = delivery.latestOnly || (delivery.minInterval.count() > 0) ||
+                   (delivery.mailboxCapacity > 0);
+    addSubscriber({callback,
+                   event_policy::asynchronous,
+                   std::make_shared<threading::Strand>(_threadPool),
+                   delivery,
+                   limited ? std::make_shared<delivery_state>() : nullptr,
+                   nullptr});
+}
+
+template <typename... Args>
+void event<Args...>::subscribe(const std::function<void(const Args&...)>& callback,
+                               event_loop& loop) {
+    addSubscriber(
+        {callback, event_policy::queued, nullptr, delivery_policy(), nullptr, &loop});
+}
+
+template <typename... Args>
+uint64_t event<Args...>::dropped() const {
+    auto callbacks = std::atomic_load(&_callbacks);
+    uint64_t dropped = 0;
+    if (callbacks) {
+        for (auto& subscriber : *callbacks) {
+            if (subscriber.state) {
+                dropped += subscriber.state->dropped.load(std::memory_order_relaxed);
+            }
         }
     }
+    return dropped;
 }
 
 template <typename... Args>
-void event<Args...>::subscribe(const std::function<void(Args...)>& callback, event_policy policy) {
+void event<Args...>::enableTracing(const std::string& name) {
     std::lock_guard<std::mutex> lock(_mutex);
-    _callbacks.emplace_back(callback, policy);
+    std::atomic_store(&_trace, event_trace::create(name));
 }
 
 template <typename... Args>
-event<Args...>::operator bool() const noexcept {
+void event<Args...>::disableTracing() {
     std::lock_guard<std::mutex> lock(_mutex);
-    return !_callbacks.empty();
+    std::atomic_store(&_trace, std::shared_ptr<event_trace>());
+}
+
+template <typename... Args>
+std::shared_ptr<event_trace> event<Args...>::trace() const {
+    return std::atomic_load(&_trace);
 }
 
 template <typename... Args>
-void event<Args...>::operator+=(const std::function<void(Args...)>& callback) {
+dispatch_mode event<Args...>::dispatchMode() const noexcept {
+    return _dispatchMode;
+}
+
+template <typename... Args>
+event<Args...>::operator bool() const noexcept {
+    auto callbacks = std::atomic_load(&_callbacks);
+    return callbacks && !callbacks->empty();
+}
+
+template <typename... Args>
+void event<Args...>::operator+=(const std::function<void(const Args&...)>& callback) {
     subscribe(callback);
 }
 
 template <typename... Args>
 event<Args...>& event<Args...>::operator=(const event& other) {
-    std::lock_guard<std::mutex> lock(other._mutex);
-    _callbacks = other._callbacks;
+    if (this == &other) {
+        return *this;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::atomic_store(&_callbacks, std::atomic_load(&other._callbacks));
+    _dispatchMode = other._dispatchMode;
+    if (_dispatchMode == dispatch_mode::per_subscriber) {
+        _strand = nullptr;
+    } else if (!_strand) {
+        _strand = std::make_shared<threading::Strand>(_threadPool);
+    }
+    std::atomic_store(&_trace, std::shared_ptr<event_trace>());
     return *this;
 }
 
 template <typename... Args>
 event<Args...>& event<Args...>::operator=(event&& other) noexcept {
-    std::lock_guard<std::mutex> lock(other._mutex);
-    _callbacks = std::move(other._callbacks);
+    if (this == &other) {
+        return *this;
+    }
+
+    std::scoped_lock<std::mutex, std::mutex> lock(_mutex, other._mutex);
+    std::atomic_store(&_callbacks,
+                      std::atomic_exchange(&other._callbacks,
+                                           std::shared_ptr<const subscriber_list>()));
+    _dispatchMode = other._dispatchMode;
+    _strand = other._strand;
+    std::atomic_store(&_trace,
+                      std::atomic_exchange(&other._trace, std::shared_ptr<event_trace>()));
     return *this;
 }
 
+template <typename... Args>
+void event<Args...>::addSubscriber(subscriber&& entry) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto callbacks = _callbacks ? std::make_shared<subscriber_list>(*_callbacks)
+                                : std::make_shared<subscriber_list>();
+    entry.index = callbacks->size();
+    callbacks->push_back(std::move(entry));
+    std::atomic_store(&_callbacks, std::shared_ptr<const subscriber_list>(std::move(callbacks)));
+}
+
+template <typename... Args>
+void event<Args...>::invoke(const subscriber& entry, const emitted& payload) {
+    if (!payload.trace) {
+        std::apply(entry.callback, payload.args);
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::apply(entry.callback, payload.args);
+    payload.trace->record(
+        entry.index, start - payload.time, std::chrono::steady_clock::now() - start);
+}
+
+template <typename... Args>
+void event<Args...>::deliver(const std::shared_ptr<const subscriber_list>& callbacks,
+                             const subscriber& entry,
+                             const payload_ptr& payload) {
+    if (entry.delivery.latestOnly || (entry.delivery.minInterval.count() > 0)) {
+        coalesce(callbacks, entry, payload);
+    } else {
+        enqueue(callbacks, entry, payload);
+    }
+}
+
+template <typename... Args>
+void event<Args...>::coalesce(const std::shared_ptr<const subscriber_list>& callbacks,
+                              const subscriber& entry,
+                              const payload_ptr& payload) {
+    auto& state = *entry.state;
+    std::lock_guard<std::mutex> lock(state.mtx);
+    if (!state.pending.empty()) {
+        state.dropped++;
+        state.pending.clear();
+    }
+    state.pending.push_back(payload);
+    // The pending delivery picks up the latest payload when it runs
+    if (state.scheduled) {
+        return;
+    }
+
+    auto task = [callbacks, &entry]() {
+        payload_ptr latest;
+        {
+            std::lock_guard<std::mutex> guard(entry.state->mtx);
+            if (!entry.state->pending.empty()) {
+                latest = std::move(entry.state->pending.back());
+                entry.state->pending.clear();
+            }
+            entry.state->scheduled = false;
+            entry.state->lastDelivery = std::chrono::steady_clock::now();
+        }
+        if (latest) {
+            invoke(entry, *latest);
+        }
+    };
+
+    auto due = state.lastDelivery + entry.delivery.minInterval;
+    if (std::chrono::steady_clock::now() >= due) {
+        state.scheduled = true;
+        entry.strand->post(task);
+    } else if (entry.delivery.trailingEdge) {
+        state.scheduled = true;
+        scheduleAt(due, [strand = entry.strand, task]() { strand->post(task); });
+    } else {
+        state.dropped++;
+        state.pending.clear();
+    }
+}
+
+template <typename... Args>
+void event<Args...>::enqueue(const std::shared_ptr<const subscriber_list>& callbacks,
+                             const subscriber& entry,
+                             const payload_ptr& payload) {
+    auto& state = *entry.state;
+    std::unique_lock<std::mutex> lock(state.mtx);
+    size_t capacity = entry.delivery.mailboxCapacity;
+    if ((capacity > 0) && (state.pending.size() >= capacity)) {
+        if ((entry.delivery.overflow == overflow_policy::drop_newest) ||
+            _threadPool.isWorkerThread()) {
+            state.dropped++;
+            return;
+        } else if (entry.delivery.overflow == overflow_policy::drop_oldest) {
+            state.dropped++;
+            state.pending.pop_front();
+        } else {
+            state.cv.wait(lock, [&state, capacity]() { return state.pending.size() < capacity; });
+        }
+    }
+
+    state.pending.push_back(payload);
+    // A single drain task per subscriber is queued in the pool, so the pool queue stays bounded
+    if (!state.scheduled) {
+        state.scheduled = true;
+        entry.strand->post([callbacks, &entry]() { drainMailbox(callbacks, entry); });
+    }
+}
+
+template <typename... Args>
+void event<Args...>::drainMailbox(const std::shared_ptr<const subscriber_list>& callbacks,
+                                  const subscriber& entry) {
+    payload_ptr payload;
+    {
+        std::lock_guard<std::mutex> lock(entry.state->mtx);
+        payload = std::move(entry.state->pending.front());
+        entry.state->pending.pop_front();
+    }
+    entry.state->cv.notify_all();
+
+    invoke(entry, *payload);
+
+    // Delivers one emit per task, so that other subscribers get the pool threads in between
+    std::lock_guard<std::mutex> lock(entry.state->mtx);
+    if (entry.state->pending.empty()) {
+        entry.state->scheduled = false;
+    } else {
+        entry.strand->post([callbacks, &entry]() { drainMailbox(callbacks, entry); });
+    }
+}
+
 } // namespace events
 } // namespace common
 } // namespace urf
\ No newline at end of file
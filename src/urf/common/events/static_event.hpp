@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+
+namespace urf {
+namespace common {
+namespace events {
+
+/**
+ * Non-owning callable reference: a function pointer plus the context it is called with. It
+ * never allocates and is invoked with a single indirect call; the referenced object or callable
+ * must outlive the delegate.
+ */
+template <typename... Args>
+class delegate {
+ public:
+    using stub_type = void (*)(void*, const Args&...);
+
+    delegate() = default;
+    delegate(stub_type stub, void* context);
+
+    template <void (*Function)(const Args&...)>
+    static delegate fromFunction();
+    template <auto Method, class T>
+    static delegate fromMethod(T* object);
+    template <class F>
+    static delegate fromCallable(F* callable);
+
+    void operator()(const Args&... args) const;
+    explicit operator bool() const noexcept;
+
+    bool operator==(const delegate& other) const noexcept;
+    bool operator!=(const delegate& other) const noexcept;
+
+ private:
+    stub_type _stub = nullptr;
+    void* _context = nullptr;
+};
+
+// Lock policy for events used by a single thread
+struct null_lock {
+    void lock() noexcept { }
+    void unlock() noexcept { }
+};
+
+/**
+ * Event with a compile-time capacity of N synchronous subscribers stored inline as delegates, for
+ * tight loops: subscribing never allocates and emit() costs one indirect call per subscriber.
+ * The Lock policy protects the subscriber list, null_lock removes any locking when the event is
+ * only used from one thread. emit() copies the delegates under the lock and calls them after
+ * releasing it, so callbacks may emit, subscribe or unsubscribe on the event they are called by;
+ * such changes apply from the next emit.
+ */
+template <size_t N, class Lock, typename... Args>
+class basic_static_event {
+ public:
+    using delegate_type = delegate<Args...>;
+
+    basic_static_event() = default;
+    basic_static_event(const basic_static_event&) = delete;
+    basic_static_event(basic_static_event&&) = delete;
+    ~basic_static_event() = default;
+
+    // Returns false when the event already has N subscribers
+    bool subscribe(const delegate_type& callback);
+    bool unsubscribe(const delegate_type& callback);
+
+    void emit(const Args&... args) const;
+
+    size_t size() const;
+    static constexpr size_t capacity() noexcept { return N; }
+    explicit operator bool() const;
+
+    basic_static_event& operator=(const basic_static_event&) = delete;
+    basic_static_event& operator=(basic_static_event&&) = delete;
+
+ private:
+    std::array<delegate_type, N> _delegates;
+    size_t _size = 0;
+    mutable Lock _lock;
+};
+
+template <size_t N, typename... Args>
+using static_event = basic_static_event<N, std::mutex, Args...>;
+
+template <size_t N, typename... Args>
+using unsynchronized_static_event = basic_static_event<N, null_lock, Args...>;
+
+template <typename... Args>
+delegate<Args...>::delegate(stub_type stub, void* context)
+    : _stub(stub)
+    , _context(context) { }
+
+template <typename... Args>
+template <void (*Function)(const Args&...)>
+delegate<Args...> delegate<Args...>::fromFunction() {
+    return delegate([](void*, const Args&... args) { Function(args...); }, nullptr);
+}
+
+template <typename... Args>
+template <auto Method, class T>
+delegate<Args...> delegate<Args...>::fromMethod(T* object) {
+    return delegate(
+        [](void* context, const Args&... args) { (static_cast<T*>(context)->*Method)(args...); },
+        object);
+}
+
+template <typename... Args>
+template <class F>
+delegate<Args...> delegate<Args...>::fromCallable(F* callable) {
+    return delegate(
+        [](void* context, const Args&... args) { (*static_cast<F*>(context))(args...); },
+        callable);
+}
+
+template <typename... Args>
+void delegate<Args...>::operator()(const Args&... args) const {
+    _stub(_context, args...);
+}
+
+template <typename... Args>
+delegate<Args...>::operator bool() const noexcept {
+    return _stub != nullptr;
+}
+
+template <typename... Args>
+bool delegate<Args...>::operator==(const delegate& other) const noexcept {
+    return (_stub == other._stub) && (_context == other._context);
+}
+
+template <typename... Args>
+bool delegate<Args...>::operator!=(const delegate& other) const noexcept {
+    return !(*this == other);
+}
+
+template <size_t N, class Lock, typename... Args>
+bool basic_static_event<N, Lock, Args...>::subscribe(const delegate_type& callback) {
+    std::lock_guard<Lock> lock(_lock);
+    if (!callback || (_size == N)) {
+        return false;
+    }
+
+    _delegates[_size++] = callback;
+    return true;
+}
+
+template <size_t N, class Lock, typename... Args>
+bool basic_static_event<N, Lock, Args...>::unsubscribe(const delegate_type& callback) {
+    std::lock_guard<Lock> lock(_lock);
+    for (size_t i = 0; i < _size; i++) {
+        if (_delegates[i] == callback) {
+            // Keeps the remaining subscribers in subscription order
+            for (size_t j = i + 1; j < _size; j++) {
+                _delegates[j - 1] = _delegates[j];
+            }
+            _delegates[--_size] = delegate_type();
+            return true;
+        }
+    }
+    return false;
+}
+
+template <size_t N, class Lock, typename... Args>
+void basic_static_event<N, Lock, Args...>::emit(const Args&... args) const {
+    std::array<delegate_type, N> delegates;
+    size_t size;
+    {
+        std::lock_guard<Lock> lock(_lock);
+        size = _size;
+        std::copy_n(_delegates.begin(), size, delegates.begin());
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        delegates[i](args...);
+    }
+}
+
+template <size_t N, class Lock, typename... Args>
+size_t basic_static_event<N, Lock, Args...>::size() const {
+    std::lock_guard<Lock> lock(_lock);
+    return _size;
+}
+
+template <size_t N, class Lock, typename... Args>
+basic_static_event<N, Lock, Args...>::operator bool() const {
+    return size() != 0;
+}
+
+} // namespace events
+} // namespace common
+} // namespace urf
@@ -0,0 +1,52 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace urf {
+namespace common {
+namespace statistics {
+
+/**
+ * Histogram of durations with power of two buckets in microseconds: bucket 0 counts durations
+ * below 1us, bucket i counts durations in [2^(i-1), 2^i) us and the last bucket everything
+ * above. Recording is a few integer operations, it is not thread safe by itself.
+ */
+class URF_COMMON_EXPORT LatencyHistogram {
+ public:
+    static constexpr size_t BucketsCount = 32;
+
+    LatencyHistogram();
+
+    void record(const std::chrono::nanoseconds& duration);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    uint64_t count() const;
+    std::chrono::nanoseconds min() const;
+    std::chrono::nanoseconds max() const;
+    std::chrono::nanoseconds mean() const;
+    // Upper bound of the bucket containing the requested percentile, in the range [0, 100]
+    std::chrono::nanoseconds percentile(double value) const;
+
+    const std::array<uint64_t, BucketsCount>& buckets() const;
+    static std::chrono::nanoseconds bucketUpperBound(size_t bucket);
+
+ private:
+    std::array<uint64_t, BucketsCount> buckets_;
+    uint64_t count_;
+    std::chrono::nanoseconds sum_;
+    std::chrono::nanoseconds min_;
+    std::chrono::nanoseconds max_;
+};
+
+} // namespace statistics
+} // namespace common
+} // namespace urf
@@ -0,0 +1,53 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#    include "urf/common/urf_common_export.h"
+#else
+#    define URF_COMMON_EXPORT
+#endif
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "urf/common/threading/ThreadPool.hpp"
+
+namespace urf {
+namespace common {
+namespace threading {
+
+/**
+ * Serial executor on top of a ThreadPool: tasks posted to the same strand run one at a time, in
+ * the order they were posted, while different strands run in parallel on the pool threads. At
+ * most one task per strand is queued in the pool, and it drains the strand queue.
+ *
+ * Posted tasks keep running after the strand is destroyed, the pool must outlive them.
+ */
+class URF_COMMON_EXPORT Strand {
+ public:
+    explicit Strand(ThreadPool& pool);
+    Strand(const Strand&) = delete;
+    Strand(Strand&&) = delete;
+    ~Strand() = default;
+
+    void post(std::function<void()> task);
+    size_t pending() const;
+
+ private:
+    struct State {
+        std::mutex mtx;
+        std::deque<std::function<void()>> tasks;
+        bool scheduled = false;
+    };
+
+    static void drain(ThreadPool& pool, const std::shared_ptr<State>& state);
+
+ private:
+    ThreadPool& pool_;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace threading
+} // namespace common
+} // namespace urf
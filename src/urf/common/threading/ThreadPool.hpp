@@ -83,6 +83,13 @@ class ThreadPool {
      * @return The number of threads.
      */
     concurrency_t getThreadCount() const;
+
+    /**
+     * @brief Check whether the calling thread is one of the threads of this pool, for instance to avoid waiting in a task for work that needs a pool thread.
+     *
+     * @return true when called from a task running in this pool.
+     */
+    bool isWorkerThread() const;
     /**
      * @brief Parallelize a loop by automatically splitting it into blocks and submitting each block separately to the queue. The user must use wait_for_tasks() or some other method to ensure that the loop finishes executing, otherwise bad things will happen.
      *
@@ -151,6 +158,13 @@ class ThreadPool {
      */
     void waitForTasks();
 
+    /**
+     * @brief Reset the number of threads in the pool. Waits for all tasks to be completed, both those that are currently running and those still waiting in the queue, which are executed by the old threads. Then destroys all threads in the pool and creates the new number of threads. Must not be called from a task running in the pool.
+     *
+     * @param thread_count_ The number of threads to use. The default value is the total number of hardware threads available, as reported by the implementation.
+     */
+    void reset(const concurrency_t thread_count_ = 0);
+
  private:
     // ========================
     // Private member functions
@@ -231,7 +245,7 @@ class ThreadPool {
 
 #pragma warning(push)
 #pragma warning(disable: 4544)
-template <typename F, typename T1, typename T2, typename T = std::common_type_t<T1, T2>>
+template <typename F, typename T1, typename T2, typename T>
 void ThreadPool::pushLoop(T1 first_index_, T2 index_after_last_, F&& loop, size_t num_blocks) {
     T first_index = static_cast<T>(first_index_);
     T index_after_last = static_cast<T>(index_after_last_);
@@ -287,9 +301,7 @@ void ThreadPool::pushTask(const F& task, const A&... args) {
 
 #pragma warning(push)
 #pragma warning(disable: 4544)
-template <typename F,
-          typename... A,
-          typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
+template <typename F, typename... A, typename R>
 [[nodiscard]] std::future<R> ThreadPool::submit(F&& task, A&&... args) {
     std::function<R()> task_function = std::bind(std::forward<F>(task), std::forward<A>(args)...);
     std::shared_ptr<std::promise<R>> task_promise = std::make_shared<std::promise<R>>();
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/IntrusiveMpscQueue.hpp>
+
+using urf::common::containers::IntrusiveMpscQueue;
+using urf::common::containers::MpscQueueHook;
+
+namespace {
+
+struct Message : MpscQueueHook {
+    int producer = 0;
+    int value = 0;
+};
+
+} // namespace
+
+TEST(IntrusiveMpscQueueShould, popInPushOrder) {
+    IntrusiveMpscQueue<Message> queue;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.tryPop(), nullptr);
+
+    Message messages[3];
+    for (int i = 0; i < 3; i++) {
+        messages[i].value = i;
+        queue.push(&messages[i]);
+    }
+
+    ASSERT_FALSE(queue.empty());
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(queue.tryPop(), &messages[i]);
+    }
+    ASSERT_EQ(queue.tryPop(), nullptr);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(IntrusiveMpscQueueShould, allowReusingPoppedElements) {
+    IntrusiveMpscQueue<Message> queue;
+    Message message;
+    for (int i = 0; i < 10; i++) {
+        message.value = i;
+        queue.push(&message);
+        auto popped = queue.tryPop();
+        ASSERT_EQ(popped, &message);
+        ASSERT_EQ(popped->value, i);
+        ASSERT_EQ(queue.tryPop(), nullptr);
+    }
+}
+
+TEST(IntrusiveMpscQueueShould, preserveOrderPerProducer) {
+    constexpr int producersCount = 4;
+    constexpr int messagesCount = 10000;
+    IntrusiveMpscQueue<Message> queue;
+    std::vector<std::unique_ptr<Message[]>> messages;
+    for (int p = 0; p < producersCount; p++) {
+        messages.emplace_back(new Message[messagesCount]);
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producersCount; p++) {
+        producers.emplace_back([&queue, &messages, p]() {
+            for (int i = 0; i < messagesCount; i++) {
+                messages[p][i].producer = p;
+                messages[p][i].value = i;
+                queue.push(&messages[p][i]);
+            }
+        });
+    }
+
+    std::vector<int> expected(producersCount, 0);
+    for (int i = 0; i < producersCount * messagesCount; i++) {
+        auto message = queue.pop(std::chrono::seconds(5));
+        ASSERT_NE(message, nullptr);
+        ASSERT_EQ(message->value, expected[message->producer]);
+        expected[message->producer]++;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    ASSERT_EQ(queue.tryPop(), nullptr);
+}
+
+TEST(IntrusiveMpscQueueShould, parkUntilPushOrTimeout) {
+    IntrusiveMpscQueue<Message> queue;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(queue.pop(std::chrono::milliseconds(50)), nullptr);
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+    Message message;
+    std::thread producer([&queue, &message]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(&message);
+    });
+    ASSERT_EQ(queue.pop(), &message);
+    producer.join();
+}
+
+TEST(IntrusiveMpscQueueShould, releaseConsumerOnNotify) {
+    IntrusiveMpscQueue<Message> queue;
+    std::thread notifier([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.notifyAll();
+    });
+    ASSERT_EQ(queue.pop(), nullptr);
+    notifier.join();
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/QueueSelector.hpp>
+
+using urf::common::containers::QueueSelector;
+using urf::common::containers::ThreadSafeQueue;
+
+TEST(QueueSelectorShould, returnReadyQueue) {
+    ThreadSafeQueue<int> ints;
+    ThreadSafeQueue<std::string> strings;
+    QueueSelector selector;
+    auto intsIndex = selector.add(ints);
+    auto stringsIndex = selector.add(strings);
+
+    strings.push("test");
+    ASSERT_EQ(selector.select().value(), stringsIndex);
+    ASSERT_EQ(strings.pop(std::chrono::milliseconds(0)).value(), "test");
+
+    ints.push(42);
+    ASSERT_EQ(selector.select().value(), intsIndex);
+}
+
+TEST(QueueSelectorShould, timeoutIfAllEmpty) {
+    ThreadSafeQueue<int> first;
+    ThreadSafeQueue<int> second;
+    QueueSelector selector;
+    selector.add(first);
+    selector.add(second);
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(selector.select(std::chrono::milliseconds(50)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+}
+
+TEST(QueueSelectorShould, wakeUpOnPush) {
+    ThreadSafeQueue<int> first;
+    ThreadSafeQueue<int> second;
+    QueueSelector selector;
+    selector.add(first);
+    auto secondIndex = selector.add(second);
+
+    std::thread producer([&second]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        second.push(42);
+    });
+
+    ASSERT_EQ(selector.select(std::chrono::seconds(5)).value(), secondIndex);
+    producer.join();
+}
+
+TEST(QueueSelectorShould, serveQueuesFairly) {
+    ThreadSafeQueue<int> first;
+    ThreadSafeQueue<int> second;
+    QueueSelector selector;
+    auto firstIndex = selector.add(first);
+    auto secondIndex = selector.add(second);
+
+    for (int i = 0; i < 10; i++) {
+        first.push(i);
+        second.push(i);
+    }
+
+    ASSERT_EQ(selector.select().value(), firstIndex);
+    ASSERT_EQ(selector.select().value(), secondIndex);
+    ASSERT_EQ(selector.select().value(), firstIndex);
+    ASSERT_EQ(selector.select().value(), secondIndex);
+}
+
+TEST(QueueSelectorShould, releaseOnNotify) {
+    ThreadSafeQueue<int> queue;
+    QueueSelector selector;
+    selector.add(queue);
+
+    std::thread notifier([&selector]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        selector.notifyAll();
+    });
+
+    ASSERT_FALSE(selector.select(std::chrono::seconds(5)));
+    notifier.join();
+}
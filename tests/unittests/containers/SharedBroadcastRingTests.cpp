@@ -0,0 +1,65 @@
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/SharedBroadcastRing.hpp>
+
+using urf::common::containers::SharedBroadcastRing;
+
+TEST(SharedBroadcastRingShould, deliverFramesToEveryReader) {
+    SharedBroadcastRing writer("test_ring_broadcast", 64, 8);
+    SharedBroadcastRing firstReader("test_ring_broadcast", 64, 8);
+    SharedBroadcastRing secondReader("test_ring_broadcast", 64, 8);
+
+    ASSERT_TRUE(writer.push("frame0"));
+    ASSERT_TRUE(writer.push("frame1"));
+    ASSERT_FALSE(writer.push(std::string(65, 'x')));
+
+    ASSERT_EQ(firstReader.read().value(), "frame0");
+    ASSERT_EQ(firstReader.read().value(), "frame1");
+    ASSERT_FALSE(firstReader.read());
+
+    ASSERT_EQ(secondReader.read().value(), "frame0");
+    ASSERT_EQ(secondReader.read().value(), "frame1");
+    ASSERT_EQ(secondReader.overruns(), 0);
+}
+
+TEST(SharedBroadcastRingShould, detectOverruns) {
+    SharedBroadcastRing writer("test_ring_overrun", 16, 4);
+    SharedBroadcastRing reader("test_ring_overrun", 16, 4);
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(writer.push("frame" + std::to_string(i)));
+    }
+
+    ASSERT_EQ(reader.read().value(), "frame6");
+    ASSERT_EQ(reader.overruns(), 6);
+    ASSERT_EQ(reader.read().value(), "frame7");
+
+    reader.seekToLatest();
+    ASSERT_FALSE(reader.read());
+    reader.seekToOldest();
+    ASSERT_EQ(reader.read().value(), "frame6");
+}
+
+TEST(SharedBroadcastRingShould, blockUntilFrameIsPushed) {
+    SharedBroadcastRing writer("test_ring_blocking", 16, 4);
+    SharedBroadcastRing reader("test_ring_blocking", 16, 4);
+
+    ASSERT_FALSE(reader.read(std::chrono::milliseconds(20)));
+
+    std::thread writerThread([&writer]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        writer.push("frame");
+    });
+    ASSERT_EQ(reader.read(std::chrono::seconds(5)).value(), "frame");
+    writerThread.join();
+}
+
+TEST(SharedBroadcastRingShould, rejectDifferentGeometry) {
+    SharedBroadcastRing writer("test_ring_geometry", 16, 4);
+    ASSERT_THROW(SharedBroadcastRing("test_ring_geometry", 32, 4), std::runtime_error);
+}
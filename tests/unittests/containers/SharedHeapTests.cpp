@@ -0,0 +1,120 @@
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/SharedHeap.hpp>
+#include <urf/common/containers/SharedString.hpp>
+#include <urf/common/containers/SharedVector.hpp>
+
+using urf::common::containers::OffsetPtr;
+using urf::common::containers::SharedHeap;
+using urf::common::containers::SharedString;
+using urf::common::containers::SharedVector;
+
+namespace {
+
+struct Record {
+    uint32_t id;
+    OffsetPtr<SharedString> name;
+    OffsetPtr<SharedVector<int>> values;
+};
+
+} // namespace
+
+TEST(SharedHeapShould, allocateAndReleaseBlocks) {
+    SharedHeap heap("test_shared_heap", 4096);
+
+    // The heap state is kept in the segment across runs
+    heap.lock();
+    heap.reset();
+    uint64_t initialFree = heap.freeBytes();
+    void* first = heap.allocate(100);
+    void* second = heap.allocate(200);
+    void* third = heap.allocate(300);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(third, nullptr);
+    ASSERT_EQ(heap.at(heap.offsetOf(second)), second);
+    ASSERT_LT(heap.freeBytes(), initialFree);
+    ASSERT_EQ(heap.allocate(8192), nullptr);
+    ASSERT_EQ(heap.allocate(std::numeric_limits<size_t>::max()), nullptr);
+    ASSERT_EQ(heap.allocate(std::numeric_limits<size_t>::max() - 8), nullptr);
+
+    // Releasing in an order that needs coalescing on both sides gives back a single block
+    heap.deallocate(first);
+    heap.deallocate(third);
+    heap.deallocate(second);
+    ASSERT_EQ(heap.freeBytes(), initialFree);
+    ASSERT_NE(heap.allocate(initialFree - 64), nullptr);
+    heap.unlock();
+}
+
+TEST(SharedHeapShould, shareContainersBetweenMappings) {
+    SharedHeap writer("test_shared_heap_containers", 8192);
+    SharedHeap reader("test_shared_heap_containers", 8192);
+    ASSERT_NE(writer.arena(), reader.arena());
+
+    writer.lock();
+    writer.reset();
+    auto record = writer.construct<Record>();
+    record->id = 42;
+    record->name = writer.construct<SharedString>("first");
+    record->name->append(" record");
+    record->values = writer.construct<SharedVector<int>>();
+    for (int i = 0; i < 100; i++) {
+        record->values->push_back(i);
+    }
+    writer.setRoot(record);
+    writer.unlock();
+
+    reader.lock();
+    auto shared = reader.root<Record>();
+    ASSERT_NE(shared, nullptr);
+    ASSERT_EQ(shared->id, 42);
+    ASSERT_EQ(shared->name->str(), "first record");
+    ASSERT_EQ(shared->values->size(), 100);
+    ASSERT_EQ(shared->values->at(99), 99);
+    ASSERT_THROW(shared->values->at(100), std::out_of_range);
+
+    *shared->name = "renamed";
+    reader.unlock();
+
+    writer.lock();
+    ASSERT_TRUE(*record->name == "renamed");
+    uint64_t freeBeforeRelease = writer.freeBytes();
+    writer.destroy(record->name.get());
+    writer.destroy(record->values.get());
+    writer.destroy(record);
+    writer.setRoot(nullptr);
+    ASSERT_GT(writer.freeBytes(), freeBeforeRelease);
+    writer.unlock();
+}
+
+TEST(SharedHeapShould, growContainersGeometrically) {
+    SharedHeap heap("test_shared_heap_growth", 16384);
+    heap.lock();
+    heap.reset();
+    ASSERT_EQ(heap.root<SharedString>(), nullptr);
+
+    auto text = heap.construct<SharedString>();
+    size_t reallocations = 0;
+    const char* previous = nullptr;
+    for (int i = 0; i < 1000; i++) {
+        text->append("x");
+        if (text->c_str() != previous) {
+            previous = text->c_str();
+            reallocations++;
+        }
+    }
+    ASSERT_EQ(text->size(), 1000);
+    ASSERT_LT(reallocations, 20);
+
+    auto values = heap.construct<SharedVector<uint64_t>>();
+    ASSERT_THROW(values->reserve(values->max_size() + 1), std::length_error);
+    ASSERT_THROW(values->reserve(values->max_size()), std::bad_alloc);
+    heap.unlock();
+}
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/SharedKeyValueStore.hpp>
+
+using urf::common::containers::SharedKeyValueStore;
+
+TEST(SharedKeyValueStoreShould, shareEntriesBetweenObjects) {
+    // The table content is kept in the segment across runs
+    SharedKeyValueStore writer("test_kv_store", 16, 16, 32);
+    writer.clear();
+    SharedKeyValueStore reader("test_kv_store", 16, 16, 32);
+
+    ASSERT_TRUE(writer.set("speed", "12.5"));
+    ASSERT_TRUE(writer.set("mode", "auto"));
+    ASSERT_FALSE(writer.set(std::string(17, 'k'), "value"));
+    ASSERT_FALSE(writer.set("key", std::string(33, 'v')));
+
+    ASSERT_EQ(reader.get("speed").value(), "12.5");
+    ASSERT_EQ(reader.get("mode").value(), "auto");
+    ASSERT_FALSE(reader.get("missing"));
+    ASSERT_EQ(reader.size(), 2);
+
+    ASSERT_TRUE(writer.set("speed", "3"));
+    ASSERT_EQ(reader.get("speed").value(), "3");
+    ASSERT_EQ(reader.size(), 2);
+
+    ASSERT_TRUE(reader.erase("speed"));
+    ASSERT_FALSE(reader.erase("speed"));
+    ASSERT_FALSE(writer.contains("speed"));
+    ASSERT_THAT(writer.keys(), ::testing::ElementsAre("mode"));
+
+    writer.clear();
+    ASSERT_EQ(reader.size(), 0);
+    ASSERT_FALSE(reader.get("mode"));
+}
+
+TEST(SharedKeyValueStoreShould, reuseErasedSlotsWhenFull) {
+    SharedKeyValueStore store("test_kv_store_full", 4, 8, 8);
+    store.clear();
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(store.set("key" + std::to_string(i), std::to_string(i)));
+    }
+    ASSERT_FALSE(store.set("key4", "4"));
+
+    // Entries placed after an erased slot in their probe chain are still found
+    ASSERT_TRUE(store.erase("key1"));
+    for (int i : {0, 2, 3}) {
+        ASSERT_EQ(store.get("key" + std::to_string(i)).value(), std::to_string(i));
+    }
+
+    ASSERT_TRUE(store.set("key4", "4"));
+    ASSERT_EQ(store.get("key4").value(), "4");
+    ASSERT_EQ(store.size(), 4);
+}
+
+TEST(SharedKeyValueStoreShould, keepEntriesAcrossChurn) {
+    SharedKeyValueStore store("test_kv_store_churn", 8, 8, 8);
+    store.clear();
+    ASSERT_TRUE(store.set("first", "1"));
+    ASSERT_TRUE(store.set("second", "2"));
+
+    // Reclaiming the tombstones at the end of probe chains must not cut off live entries
+    for (int i = 0; i < 1000; i++) {
+        std::string key = "key" + std::to_string(i);
+        ASSERT_TRUE(store.set(key, std::to_string(i)));
+        if (i % 3 == 0) {
+            ASSERT_TRUE(store.set("extra", key));
+            ASSERT_TRUE(store.erase("extra"));
+        }
+        ASSERT_EQ(store.get("first").value(), "1");
+        ASSERT_EQ(store.get("second").value(), "2");
+        ASSERT_EQ(store.get(key).value(), std::to_string(i));
+        ASSERT_TRUE(store.erase(key));
+        ASSERT_FALSE(store.get(key));
+    }
+    ASSERT_EQ(store.size(), 2);
+}
+
+TEST(SharedKeyValueStoreShould, neverReturnTornValues) {
+    SharedKeyValueStore writer("test_kv_store_torn", 8, 8, 64);
+    writer.clear();
+    SharedKeyValueStore reader("test_kv_store_torn", 8, 8, 64);
+    writer.set("value", std::string(64, 'a'));
+
+    std::atomic<bool> stop(false);
+    std::thread writerThread([&writer, &stop]() {
+        char c = 'a';
+        while (!stop) {
+            c = c == 'z' ? 'a' : c + 1;
+            writer.set("value", std::string(64, c));
+        }
+    });
+
+    for (int i = 0; i < 100000; i++) {
+        auto value = reader.get("value");
+        ASSERT_TRUE(value);
+        ASSERT_EQ(value->length(), 64);
+        ASSERT_EQ(value->find_first_not_of(value->front()), std::string::npos);
+    }
+
+    stop = true;
+    writerThread.join();
+}
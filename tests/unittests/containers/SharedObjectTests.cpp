@@ -1,6 +1,14 @@
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <thread>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -45,3 +53,128 @@ TEST(SharedObjectShould, correctlyWriteIfShorter) {
         ASSERT_TRUE(obj3.unlock());
     }
 }
+
+TEST(SharedObjectShould, readConsistentSnapshotsWithoutLocking) {
+    SharedObject writer("test_object_seqlock", 1024);
+    SharedObject reader("test_object_seqlock", 1024);
+    ASSERT_TRUE(writer.write(std::string(512, 'a')));
+    ASSERT_EQ(reader.snapshot(), std::string(512, 'a'));
+
+    std::atomic<bool> stop(false);
+    std::thread writerThread([&writer, &stop]() {
+        char value = 'a';
+        while (!stop) {
+            value = value == 'z' ? 'a' : value + 1;
+            writer.write(std::string(512, value));
+        }
+    });
+
+    for (int i = 0; i < 1000; i++) {
+        auto snapshot = reader.snapshot();
+        ASSERT_EQ(snapshot.size(), 512);
+        ASSERT_EQ(snapshot, std::string(512, snapshot[0]));
+    }
+
+    stop = true;
+    writerThread.join();
+}
+
+TEST(SharedObjectShould, storeBinaryPayloads) {
+    const char payload[] = {'a', '\0', 'b', '\0', 'c'};
+    SharedObject writer("test_object_binary", 1024);
+    ASSERT_TRUE(writer.lock());
+    ASSERT_TRUE(writer.writeBytes(payload, sizeof(payload)));
+    ASSERT_TRUE(writer.unlock());
+    ASSERT_FALSE(writer.writeBytes(payload, 1024, 1));
+
+    SharedObject reader("test_object_binary", 1024);
+    ASSERT_EQ(reader.capacity(), 1024);
+    ASSERT_EQ(reader.size(), sizeof(payload));
+    ASSERT_EQ(std::memcmp(reader.data(), payload, sizeof(payload)), 0);
+    ASSERT_EQ(reader.read(), std::string(payload, sizeof(payload)));
+    ASSERT_EQ(reader.snapshot(), std::string(payload, sizeof(payload)));
+}
+
+TEST(SharedObjectShould, writeInPlace) {
+    SharedObject writer("test_object_in_place", 1024);
+    ASSERT_TRUE(writer.lock());
+    char* buffer = writer.beginWrite();
+    std::memset(buffer, 'x', 100);
+    writer.endWrite(100);
+    ASSERT_TRUE(writer.unlock());
+
+    SharedObject reader("test_object_in_place", 1024);
+    ASSERT_EQ(reader.size(), 100);
+    ASSERT_EQ(reader.snapshot(), std::string(100, 'x'));
+}
+
+TEST(SharedObjectShould, writeOnlyTheGivenRanges) {
+    SharedObject obj("test_object_ranges", 1024);
+    ASSERT_TRUE(obj.lock());
+    ASSERT_TRUE(obj.write("0123456789"));
+    ASSERT_TRUE(obj.writev({{2, "ab", 2}, {6, "cd", 2}}));
+    ASSERT_EQ(obj.read(), "01ab45cd89");
+
+    ASSERT_TRUE(obj.writev({{12, "ef", 2}}));
+    ASSERT_EQ(obj.read(), std::string("01ab45cd89\0\0ef", 14));
+
+    ASSERT_FALSE(obj.writev({{0, "gh", 2}, {1023, "ij", 2}}));
+    ASSERT_EQ(obj.read(2), "01");
+
+    ASSERT_TRUE(obj.write("xy", 1));
+    ASSERT_EQ(obj.read(), "0xy");
+    ASSERT_TRUE(obj.unlock());
+}
+
+TEST(SharedObjectShould, notifyUpdatesToWaiters) {
+    SharedObject writer("test_object_notify", 1024);
+    SharedObject reader("test_object_notify", 1024);
+
+    auto version = reader.version();
+    ASSERT_FALSE(reader.waitForUpdate(version, std::chrono::milliseconds(20)));
+
+    std::thread writerThread([&writer]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        writer.write("update");
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(reader.waitForUpdate(version, std::chrono::seconds(5)));
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    ASSERT_NE(reader.version(), version);
+    ASSERT_EQ(reader.snapshot(), "update");
+    writerThread.join();
+}
+
+TEST(SharedObjectShould, alignPayloadForAnyType) {
+    SharedObject object("test_object_alignment", 64);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(object.data()) % alignof(std::max_align_t), 0);
+}
+
+TEST(SharedObjectShould, placeSegmentInPosixSharedMemory) {
+    // Memory locking is left out, it depends on the RLIMIT_MEMLOCK of the host
+    SharedObject::Options options;
+    options.backing = SharedObject::Backing::PosixShm;
+    options.hugePages = true;
+    options.prefault = true;
+#ifdef __linux__
+    shm_unlink("/test_object_shm.sobj");
+#endif
+    {
+        SharedObject writer("test_object_shm", 1 << 20, options);
+        ASSERT_TRUE(writer.lock());
+        ASSERT_TRUE(writer.write("in memory"));
+        ASSERT_TRUE(writer.unlock());
+
+        SharedObject reader("test_object_shm", 1 << 20, options);
+        ASSERT_EQ(reader.snapshot(), "in memory");
+    }
+
+    {
+        SharedObject reader("test_object_shm", 1 << 20, options);
+        ASSERT_EQ(reader.snapshot(), "in memory");
+    }
+#ifdef __linux__
+    ASSERT_EQ(shm_unlink("/test_object_shm.sobj"), 0);
+#endif
+}
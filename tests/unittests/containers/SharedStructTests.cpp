@@ -0,0 +1,73 @@
+#include <atomic>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/SharedStruct.hpp>
+
+using urf::common::containers::SharedStruct;
+
+namespace {
+
+struct JointState {
+    uint64_t counter;
+    double position[6];
+    double velocity[6];
+};
+
+} // namespace
+
+TEST(SharedStructShould, shareStructBetweenObjects) {
+    SharedStruct<JointState> writer("test_struct");
+    JointState state{};
+    state.counter = 42;
+    state.position[3] = 1.5;
+    ASSERT_TRUE(writer.store(state));
+
+    SharedStruct<JointState> reader("test_struct");
+    ASSERT_EQ(reader.load().counter, 42);
+    ASSERT_EQ(reader.snapshot().position[3], 1.5);
+
+    ASSERT_TRUE(reader.lock());
+    ASSERT_EQ(reader.get()->counter, 42);
+    ASSERT_TRUE(reader.unlock());
+}
+
+TEST(SharedStructShould, updateInPlace) {
+    SharedStruct<JointState> writer("test_struct_update");
+    ASSERT_TRUE(writer.update([](JointState& state) { state.counter = 1; }));
+    ASSERT_TRUE(writer.update([](JointState& state) { state.counter++; }));
+
+    SharedStruct<JointState> reader("test_struct_update");
+    ASSERT_EQ(reader.snapshot().counter, 2);
+}
+
+TEST(SharedStructShould, readConsistentSnapshots) {
+    SharedStruct<JointState> writer("test_struct_snapshot");
+    SharedStruct<JointState> reader("test_struct_snapshot");
+
+    std::atomic<bool> stop(false);
+    std::thread writerThread([&writer, &stop]() {
+        uint64_t counter = 0;
+        while (!stop) {
+            counter++;
+            writer.update([counter](JointState& state) {
+                state.counter = counter;
+                for (int i = 0; i < 6; i++) {
+                    state.position[i] = static_cast<double>(counter);
+                }
+            });
+        }
+    });
+
+    for (int i = 0; i < 1000; i++) {
+        auto state = reader.snapshot();
+        for (int k = 0; k < 6; k++) {
+            ASSERT_EQ(state.position[k], static_cast<double>(state.counter));
+        }
+    }
+
+    stop = true;
+    writerThread.join();
+}
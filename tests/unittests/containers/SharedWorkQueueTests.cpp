@@ -0,0 +1,96 @@
+#include <chrono>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/SharedWorkQueue.hpp>
+
+using urf::common::containers::SharedWorkQueue;
+
+TEST(SharedWorkQueueShould, moveRecordsBetweenObjects) {
+    SharedWorkQueue producer("test_work_queue", 32, 4);
+    producer.reset();
+    SharedWorkQueue consumer("test_work_queue", 32, 4);
+
+    ASSERT_TRUE(producer.push("job0"));
+    ASSERT_TRUE(producer.push("job1"));
+    ASSERT_FALSE(producer.push(std::string(33, 'x')));
+    ASSERT_EQ(consumer.size(), 2);
+
+    ASSERT_EQ(consumer.pop().value(), "job0");
+    ASSERT_EQ(consumer.pop().value(), "job1");
+    ASSERT_TRUE(consumer.empty());
+    ASSERT_FALSE(consumer.pop(std::chrono::milliseconds(20)));
+}
+
+TEST(SharedWorkQueueShould, blockProducersWhileFull) {
+    SharedWorkQueue producer("test_work_queue_full", 32, 2);
+    producer.reset();
+    SharedWorkQueue consumer("test_work_queue_full", 32, 2);
+
+    ASSERT_TRUE(producer.push("job0"));
+    ASSERT_TRUE(producer.push("job1"));
+    ASSERT_FALSE(producer.push("job2", std::chrono::milliseconds(20)));
+
+    std::thread consumerThread([&consumer]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        consumer.pop();
+    });
+    ASSERT_TRUE(producer.push("job2", std::chrono::seconds(5)));
+    consumerThread.join();
+
+    ASSERT_EQ(consumer.pop().value(), "job1");
+    ASSERT_EQ(consumer.pop().value(), "job2");
+}
+
+TEST(SharedWorkQueueShould, deliverEachRecordOnce) {
+    constexpr int recordsCount = 1000;
+    SharedWorkQueue producer("test_work_queue_mpmc", 16, 8);
+    producer.reset();
+    SharedWorkQueue firstConsumer("test_work_queue_mpmc", 16, 8);
+    SharedWorkQueue secondConsumer("test_work_queue_mpmc", 16, 8);
+
+    std::set<std::string> first;
+    std::set<std::string> second;
+    auto consume = [](SharedWorkQueue& queue, std::set<std::string>& received) {
+        while (auto record = queue.pop()) {
+            received.insert(*record);
+        }
+    };
+    std::thread firstThread(consume, std::ref(firstConsumer), std::ref(first));
+    std::thread secondThread(consume, std::ref(secondConsumer), std::ref(second));
+
+    for (int i = 0; i < recordsCount; i++) {
+        ASSERT_TRUE(producer.push(std::to_string(i)));
+    }
+    while (!producer.empty()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    producer.dispose();
+    firstThread.join();
+    secondThread.join();
+
+    ASSERT_EQ(first.size() + second.size(), recordsCount);
+    first.insert(second.begin(), second.end());
+    ASSERT_EQ(first.size(), recordsCount);
+    ASSERT_TRUE(firstConsumer.isDisposed());
+}
+
+TEST(SharedWorkQueueShould, beReusableAfterReset) {
+    SharedWorkQueue queue("test_work_queue_reset", 16, 4);
+    queue.reset();
+    ASSERT_TRUE(queue.push("job0"));
+    queue.dispose();
+    ASSERT_FALSE(queue.push("job1"));
+
+    SharedWorkQueue restarted("test_work_queue_reset", 16, 4);
+    ASSERT_TRUE(restarted.isDisposed());
+    restarted.reset();
+    ASSERT_FALSE(queue.isDisposed());
+    ASSERT_TRUE(queue.empty());
+    ASSERT_TRUE(queue.push("job1"));
+    ASSERT_EQ(restarted.pop().value(), "job1");
+}
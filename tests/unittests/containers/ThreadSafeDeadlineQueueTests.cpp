@@ -0,0 +1,63 @@
+#include <chrono>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/ThreadSafeDeadlineQueue.hpp>
+
+using urf::common::containers::ThreadSafeDeadlineQueue;
+
+TEST(ThreadSafeDeadlineQueueShould, popInScheduledOrder) {
+    ThreadSafeDeadlineQueue<int> queue;
+    auto now = std::chrono::steady_clock::now();
+    queue.push(2, now - std::chrono::milliseconds(10));
+    queue.push(1, now - std::chrono::milliseconds(20));
+    queue.push(3, now - std::chrono::milliseconds(10));
+
+    ASSERT_EQ(queue.pop().value(), 1);
+    ASSERT_EQ(queue.pop().value(), 2);
+    ASSERT_EQ(queue.pop().value(), 3);
+}
+
+TEST(ThreadSafeDeadlineQueueShould, notPopBeforeScheduledTime) {
+    ThreadSafeDeadlineQueue<int> queue;
+    auto scheduledAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    queue.push(42, scheduledAt);
+
+    ASSERT_FALSE(queue.pop(std::chrono::milliseconds(20)));
+    ASSERT_FALSE(queue.popUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(20)));
+    ASSERT_EQ(queue.size(), 1);
+
+    ASSERT_EQ(queue.pop().value(), 42);
+    ASSERT_GE(std::chrono::steady_clock::now(), scheduledAt);
+}
+
+TEST(ThreadSafeDeadlineQueueShould, wakeUpForEarlierElement) {
+    ThreadSafeDeadlineQueue<int> queue;
+    auto now = std::chrono::steady_clock::now();
+    queue.push(1, now + std::chrono::seconds(10));
+
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(2, std::chrono::steady_clock::now());
+    });
+
+    ASSERT_EQ(queue.popUntil(now + std::chrono::seconds(1)).value(), 2);
+    ASSERT_LT(std::chrono::steady_clock::now() - now, std::chrono::seconds(1));
+    producer.join();
+}
+
+TEST(ThreadSafeDeadlineQueueShould, releaseWaitersOnNotify) {
+    ThreadSafeDeadlineQueue<int> queue;
+    queue.push(1, std::chrono::steady_clock::now() + std::chrono::seconds(10));
+
+    std::thread notifier([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.notifyAll();
+    });
+
+    ASSERT_FALSE(queue.pop());
+    notifier.join();
+    ASSERT_EQ(queue.size(), 1);
+}
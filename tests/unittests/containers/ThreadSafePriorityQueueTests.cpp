@@ -0,0 +1,67 @@
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/ThreadSafePriorityQueue.hpp>
+
+using urf::common::containers::ThreadSafePriorityQueue;
+
+TEST(ThreadSafePriorityQueueShould, popHighestPriorityFirst) {
+    ThreadSafePriorityQueue<int> queue;
+    queue.push(3);
+    queue.push(7);
+    queue.push(1);
+
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queue.pop().value(), 7);
+    ASSERT_EQ(queue.pop().value(), 3);
+    ASSERT_EQ(queue.pop().value(), 1);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(ThreadSafePriorityQueueShould, useCustomCompare) {
+    ThreadSafePriorityQueue<std::string, std::greater<std::string>> queue;
+    queue.push("b");
+    queue.push("c");
+    queue.push("a");
+
+    ASSERT_EQ(queue.pop().value(), "a");
+    ASSERT_EQ(queue.pop().value(), "b");
+    ASSERT_EQ(queue.pop().value(), "c");
+}
+
+TEST(ThreadSafePriorityQueueShould, timeoutIfEmpty) {
+    ThreadSafePriorityQueue<int> queue;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(queue.pop(std::chrono::milliseconds(50)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+}
+
+TEST(ThreadSafePriorityQueueShould, wakeUpOnPush) {
+    ThreadSafePriorityQueue<int> queue;
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(42);
+    });
+
+    ASSERT_EQ(queue.pop().value(), 42);
+    producer.join();
+}
+
+TEST(ThreadSafePriorityQueueShould, releaseWaitersOnDispose) {
+    ThreadSafePriorityQueue<int> queue;
+    std::thread disposer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.dispose();
+    });
+
+    ASSERT_FALSE(queue.pop());
+    disposer.join();
+
+    queue.push(1);
+    ASSERT_TRUE(queue.isDisposed());
+    ASSERT_EQ(queue.size(), 0);
+}
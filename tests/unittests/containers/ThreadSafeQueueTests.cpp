@@ -0,0 +1,88 @@
+#include <chrono>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/containers/ThreadSafeQueue.hpp>
+
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+using urf::common::containers::ThreadSafeQueue;
+
+#ifdef __linux__
+namespace {
+
+bool isReadable(int fd) {
+    pollfd pfd{fd, POLLIN, 0};
+    return (::poll(&pfd, 1, 0) == 1) && (pfd.revents & POLLIN);
+}
+
+} // namespace
+
+TEST(ThreadSafeQueueShould, exposeEventFdReadableWhileNotEmpty) {
+    ThreadSafeQueue<int> queue;
+    int fd = queue.eventFd();
+    ASSERT_NE(fd, -1);
+    ASSERT_FALSE(isReadable(fd));
+
+    queue.push(1);
+    queue.push(2);
+    ASSERT_TRUE(isReadable(fd));
+
+    ASSERT_EQ(queue.pop(std::chrono::milliseconds(0)).value(), 1);
+    ASSERT_TRUE(isReadable(fd));
+    ASSERT_EQ(queue.pop(std::chrono::milliseconds(0)).value(), 2);
+    ASSERT_FALSE(isReadable(fd));
+
+    queue.push(3);
+    ASSERT_TRUE(isReadable(fd));
+    queue.clear();
+    ASSERT_FALSE(isReadable(fd));
+}
+
+TEST(ThreadSafeQueueShould, signalEventFdForPendingElements) {
+    ThreadSafeQueue<int> queue;
+    queue.push(1);
+    int fd = queue.eventFd();
+    ASSERT_TRUE(isReadable(fd));
+    ASSERT_EQ(queue.eventFd(), fd);
+
+    queue.dispose();
+    ASSERT_FALSE(isReadable(fd));
+}
+#endif
+
+TEST(ThreadSafeQueueShould, recordStatisticsWhenEnabled) {
+    using urf::common::containers::QueueStatistics;
+    ThreadSafeQueue<int, QueueStatistics> queue;
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(queue.pop().value(), 1);
+    ASSERT_EQ(queue.pop().value(), 2);
+
+    auto statistics = queue.statistics();
+    ASSERT_EQ(statistics.depth, 1);
+    ASSERT_EQ(statistics.peakDepth, 3);
+    ASSERT_EQ(statistics.pushes, 3);
+    ASSERT_EQ(statistics.pops, 2);
+    ASSERT_GT(statistics.pushRate, 0);
+    ASSERT_EQ(statistics.waitTime.count(), 2);
+    ASSERT_GE(statistics.waitTime.min(), std::chrono::milliseconds(10));
+
+    queue.resetStatistics();
+    statistics = queue.statistics();
+    ASSERT_EQ(statistics.pushes, 0);
+    ASSERT_EQ(statistics.peakDepth, 1);
+    ASSERT_EQ(statistics.waitTime.count(), 0);
+}
+
+TEST(ThreadSafeQueueShould, notRecordStatisticsByDefault) {
+    ThreadSafeQueue<int> queue;
+    queue.push(1);
+    ASSERT_EQ(queue.statistics().pushes, 0);
+}
@@ -0,0 +1,82 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/events/event_bus.hpp>
+
+using namespace urf::common::events;
+
+TEST(EventBusShould, routePublishedEventsByTopicHash) {
+    event_bus bus;
+    std::vector<int> received;
+    bus.subscribe<int>(
+        "robot/joints", [&received](int i) { received.push_back(i); },
+        event_policy::synchronous);
+
+    auto joints = bus.registerTopic<int>("robot/joints");
+    static_assert(hashTopic("robot/joints") == hashTopic(std::string_view("robot/joints")));
+    ASSERT_EQ(joints.id(), hashTopic("robot/joints"));
+
+    bus.publish(joints, 1);
+    ASSERT_TRUE(bus.publish<int>(joints.id(), 2));
+    ASSERT_FALSE(bus.publish<int>(hashTopic("robot/unknown"), 3));
+    ASSERT_THAT(received, ::testing::ElementsAre(1, 2));
+    ASSERT_THAT(bus.topics(), ::testing::ElementsAre("robot/joints"));
+}
+
+TEST(EventBusShould, convertPublishedArgumentsToTheTopicTypes) {
+    event_bus bus;
+    std::vector<std::string> names;
+    std::vector<double> values;
+    auto name = bus.subscribe<std::string>(
+        "robot/name", [&names](const std::string& s) { names.push_back(s); },
+        event_policy::synchronous);
+    auto value = bus.subscribe<double>(
+        "robot/value", [&values](double d) { values.push_back(d); }, event_policy::synchronous);
+
+    bus.publish(name, "literal");
+    ASSERT_TRUE(bus.publish<std::string>(name.id(), "by id"));
+    bus.publish(value, 1.5f);
+    bus.publish(value, 2);
+    ASSERT_THAT(names, ::testing::ElementsAre("literal", "by id"));
+    ASSERT_THAT(values, ::testing::ElementsAre(1.5, 2.0));
+}
+
+TEST(EventBusShould, subscribeByPrefixToExistingAndFutureTopics) {
+    event_bus bus;
+    std::vector<std::string> received;
+    auto left = bus.registerTopic<std::string>("robot/left");
+    auto other = bus.registerTopic<std::string>("camera/image");
+    auto mismatched = bus.registerTopic<int>("robot/count");
+
+    bus.subscribePrefix<std::string>(
+        "robot/", [&received](const std::string& s) { received.push_back(s); },
+        event_policy::synchronous);
+    auto right = bus.registerTopic<std::string>("robot/right");
+
+    bus.publish(left, "left");
+    bus.publish(other, "image");
+    bus.publish(mismatched, 3);
+    bus.publish(right, "right");
+    ASSERT_THAT(received, ::testing::ElementsAre("left", "right"));
+}
+
+TEST(EventBusShould, rejectTopicsUsedWithDifferentArguments) {
+    event_bus bus;
+    auto joints = bus.registerTopic<int>("robot/joints");
+
+    ASSERT_NO_THROW(bus.registerTopic<int>("robot/joints"));
+    ASSERT_THROW(bus.registerTopic<double>("robot/joints"), std::invalid_argument);
+    auto subscribeTwoArguments = [&bus]() {
+        bus.subscribe<int, int>("robot/joints", [](int, int) {});
+    };
+    ASSERT_THROW(subscribeTwoArguments(), std::invalid_argument);
+    ASSERT_THROW(bus.publish<double>(joints.id(), 1.0), std::invalid_argument);
+}
+
+TEST(EventBusShould, beProcessWide) {
+    ASSERT_EQ(&event_bus::instance(), &event_bus::instance());
+}
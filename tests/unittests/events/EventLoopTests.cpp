@@ -0,0 +1,76 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/events/event_loop.hpp>
+#include <urf/common/events/events.hpp>
+
+using namespace urf::common::events;
+
+TEST(EventLoopShould, runQueuedCallbacksOnTheOwningThread) {
+    event_loop loop;
+    event<int> e;
+    std::vector<int> received;
+    std::thread::id callbackThread;
+    e.subscribe(
+        [&received, &callbackThread](int i) {
+            received.push_back(i);
+            callbackThread = std::this_thread::get_id();
+        },
+        loop);
+
+    std::thread emitter([&e]() {
+        for (int i = 0; i < 10; i++) {
+            e.emit(i);
+        }
+    });
+    emitter.join();
+
+    ASSERT_TRUE(received.empty());
+    ASSERT_EQ(loop.pending(), 10);
+    ASSERT_EQ(loop.processEvents(), 10);
+    ASSERT_EQ(callbackThread, std::this_thread::get_id());
+    ASSERT_THAT(received, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    ASSERT_EQ(loop.processEvents(), 0);
+}
+
+TEST(EventLoopShould, leaveCallbacksPostedWhileProcessingToTheNextCall) {
+    event_loop loop;
+    event<int> e;
+    int received = 0;
+    e.subscribe(
+        [&e, &received](int i) {
+            received++;
+            e.emit(i + 1);
+        },
+        loop);
+
+    e.emit(0);
+    ASSERT_EQ(loop.processEvents(), 1);
+    ASSERT_EQ(loop.processEvents(), 1);
+    ASSERT_EQ(received, 2);
+    ASSERT_EQ(loop.pending(), 1);
+}
+
+TEST(EventLoopShould, waitForCallbacks) {
+    event_loop loop;
+    event<int> e;
+    std::atomic<int> received(0);
+    e.subscribe([&received](int i) { received = i; }, loop);
+
+    ASSERT_EQ(loop.processEvents(std::chrono::milliseconds(10)), 0);
+
+    std::thread emitter([&e]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        e.emit(42);
+    });
+    ASSERT_EQ(loop.processEvents(std::chrono::seconds(2)), 1);
+    ASSERT_EQ(received, 42);
+    emitter.join();
+
+    ASSERT_THROW(e.subscribe([](int) {}, event_policy::queued), std::invalid_argument);
+}
@@ -0,0 +1,102 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/events/event_trace.hpp>
+#include <urf/common/events/events.hpp>
+
+using namespace urf::common::events;
+
+TEST(EventTraceShould, measureQueueDelayAndCallbackDuration) {
+    event<int> e;
+    std::atomic<int> received(0);
+    e.subscribe(
+        [&received](int) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            received++;
+        },
+        event_policy::synchronous);
+    e.subscribe([&received](int) { received++; }, event_policy::asynchronous);
+
+    e.emit(0);
+    ASSERT_FALSE(e.trace());
+    e.enableTracing("traced_event");
+    ASSERT_EQ(e.trace()->name(), "traced_event");
+    for (int i = 0; i < 10; i++) {
+        e.emit(i);
+    }
+
+    // The last callback records its timings right after returning
+    auto recorded = [&e]() {
+        auto subscribers = e.trace()->snapshot();
+        return (subscribers.size() == 2) && (subscribers[0].callbackDuration.count() == 10) &&
+               (subscribers[1].callbackDuration.count() == 10);
+    };
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!recorded() && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(received, 22);
+
+    auto subscribers = e.trace()->snapshot();
+    ASSERT_EQ(subscribers.size(), 2);
+    ASSERT_EQ(subscribers[0].event, "traced_event");
+    ASSERT_EQ(subscribers[0].subscriber, 0);
+    ASSERT_EQ(subscribers[0].callbackDuration.count(), 10);
+    ASSERT_GE(subscribers[0].callbackDuration.min(), std::chrono::milliseconds(5));
+
+    // The asynchronous subscriber waits at least for the synchronous callback of its emit
+    ASSERT_EQ(subscribers[1].subscriber, 1);
+    ASSERT_EQ(subscribers[1].queueDelay.count(), 10);
+    ASSERT_GE(subscribers[1].queueDelay.min(), std::chrono::milliseconds(5));
+
+    e.trace()->reset();
+    ASSERT_EQ(e.trace()->snapshot()[1].queueDelay.count(), 0);
+}
+
+TEST(EventTraceShould, listTheTracesOfLivingEvents) {
+    auto countTraces = [](const std::string& name) {
+        size_t count = 0;
+        for (auto& subscriber : event_trace::snapshotAll()) {
+            if (subscriber.event == name) {
+                count++;
+            }
+        }
+        return count;
+    };
+
+    {
+        event<int> e;
+        e.subscribe([](int) {}, event_policy::synchronous);
+        e.enableTracing("registered_event");
+        e.emit(1);
+        ASSERT_EQ(countTraces("registered_event"), 1);
+
+        event_trace::resetAll();
+        ASSERT_EQ(e.trace()->snapshot()[0].callbackDuration.count(), 0);
+    }
+
+    ASSERT_EQ(countTraces("registered_event"), 0);
+}
+
+TEST(EventTraceShould, followMovesButNotCopies) {
+    event<int> traced;
+    traced.enableTracing("moved_trace");
+
+    event<int> copied(traced);
+    ASSERT_FALSE(copied.trace());
+    event<int> assigned;
+    assigned.enableTracing("assigned_trace");
+    assigned = traced;
+    ASSERT_FALSE(assigned.trace());
+    ASSERT_TRUE(traced.trace());
+
+    event<int> moved(std::move(traced));
+    ASSERT_EQ(moved.trace()->name(), "moved_trace");
+    event<int> moveAssigned;
+    moveAssigned = std::move(moved);
+    ASSERT_EQ(moveAssigned.trace()->name(), "moved_trace");
+}
@@ -1,8 +1,31 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <urf/common/events/events.hpp>
 
 using namespace urf::common::events;
 
+namespace {
+
+struct CopyCounter {
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter& other)
+        : copies(other.copies) {
+        (*copies)++;
+    }
+
+    std::shared_ptr<std::atomic<int>> copies = std::make_shared<std::atomic<int>>(0);
+};
+
+} // namespace
+
 TEST(EventTests, correctlyEmitAndReceiveSynchronousEvents) {
     event<int> e;
     int received = 0;
@@ -141,4 +164,368 @@ TEST(EventTests, boolOperator) {
     ASSERT_EQ(received, 42);
     e = event<int>();
     ASSERT_FALSE(e);
-}
\ No newline at end of file
+}
+
+TEST(EventTests, subscribeAndEmitFromCallbacks) {
+    event<int> e;
+    int received = 0;
+    e.subscribe(
+        [&e, &received](int i) {
+            received += i;
+            if (i > 0) {
+                e.subscribe([&received](int j) { received += 100 * j; },
+                            event_policy::synchronous);
+                e.emit(i - 1);
+            }
+        },
+        event_policy::synchronous);
+
+    e.emit(1);
+    ASSERT_EQ(received, 1);
+    e.emit(0);
+    ASSERT_EQ(received, 1);
+}
+
+TEST(EventTests, runSynchronousCallbacksOfConcurrentEmits) {
+    event<int> e;
+    std::atomic<int> inside(0);
+    std::atomic<bool> overlapped(false);
+    e.subscribe(
+        [&inside, &overlapped](int) {
+            inside++;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while ((inside < 2) && (std::chrono::steady_clock::now() < deadline)) {
+                std::this_thread::yield();
+            }
+            if (inside == 2) {
+                overlapped = true;
+            }
+        },
+        event_policy::synchronous);
+
+    std::thread first([&e]() { e.emit(1); });
+    std::thread second([&e]() { e.emit(2); });
+    first.join();
+    second.join();
+    ASSERT_TRUE(overlapped);
+}
+
+TEST(EventTests, keepSubscriberOrderWithManyDispatchThreads) {
+    event_base::setDispatchThreads(4);
+    ASSERT_EQ(event_base::dispatchThreads(), 4);
+
+    event<int> e;
+    std::vector<std::vector<int>> received(4);
+    for (auto& values : received) {
+        e.subscribe([&values](int i) { values.push_back(i); }, event_policy::asynchronous);
+    }
+
+    for (int i = 0; i < 1000; i++) {
+        e.emit(i);
+    }
+
+    // Waits for the pending callbacks
+    event_base::setDispatchThreads(1);
+    for (auto& values : received) {
+        ASSERT_EQ(values.size(), 1000);
+        for (int i = 0; i < 1000; i++) {
+            ASSERT_EQ(values[i], i);
+        }
+    }
+}
+
+TEST(EventTests, shareAsynchronousPayloadBetweenSubscribers) {
+    event<CopyCounter> e;
+    std::atomic<int> received(0);
+    for (int i = 0; i < 5; i++) {
+        e.subscribe([&received](const CopyCounter&) { received++; }, event_policy::asynchronous);
+    }
+    e.subscribe([&received](const CopyCounter&) { received++; }, event_policy::synchronous);
+
+    CopyCounter payload;
+    e.emit(payload);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((received < 6) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(received, 6);
+    ASSERT_EQ(*payload.copies, 1);
+}
+
+TEST(EventTests, invokeAllAsynchronousSubscribersInOneTaskPerEmit) {
+    event_base::setDispatchThreads(4);
+
+    event<int> e(dispatch_mode::per_emit);
+    ASSERT_EQ(e.dispatchMode(), dispatch_mode::per_emit);
+
+    // The mutex only keeps a regression from racing: overlapping callbacks are detected apart
+    std::mutex mtx;
+    std::vector<std::pair<int, int>> received;
+    std::atomic<int> running(0);
+    std::atomic<bool> overlapped(false);
+    for (int subscriber = 0; subscriber < 8; subscriber++) {
+        e.subscribe(
+            [subscriber, &mtx, &received, &running, &overlapped](int i) {
+                if (running.fetch_add(1) != 0) {
+                    overlapped = true;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    received.emplace_back(i, subscriber);
+                }
+                running--;
+            },
+            event_policy::asynchronous);
+    }
+
+    for (int i = 0; i < 500; i++) {
+        e.emit(i);
+    }
+
+    event_base::setDispatchThreads(1);
+    ASSERT_FALSE(overlapped);
+    std::lock_guard<std::mutex> lock(mtx);
+    ASSERT_EQ(received.size(), 500 * 8);
+    for (size_t n = 0; n < received.size(); n++) {
+        ASSERT_EQ(received[n].first, static_cast<int>(n / 8));
+        ASSERT_EQ(received[n].second, static_cast<int>(n % 8));
+    }
+}
+
+namespace {
+
+template <typename Predicate>
+bool waitFor(Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!predicate() && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return predicate();
+}
+
+} // namespace
+
+TEST(EventTests, collapsePendingEmitsForLatestOnlySubscribers) {
+    event<int> e;
+    std::mutex mtx;
+    std::vector<int> received;
+    std::atomic<bool> started(false);
+    std::atomic<bool> release(false);
+    delivery_policy latestOnly;
+    latestOnly.latestOnly = true;
+    e.subscribe(
+        [&](int i) {
+            started = true;
+            while (!release) {
+                std::this_thread::yield();
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            received.push_back(i);
+        },
+        latestOnly);
+
+    e.emit(0);
+    ASSERT_TRUE(waitFor([&started]() { return started.load(); }));
+    for (int i = 1; i <= 100; i++) {
+        e.emit(i);
+    }
+    release = true;
+
+    ASSERT_TRUE(waitFor([&]() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return received.size() == 2;
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::lock_guard<std::mutex> lock(mtx);
+    ASSERT_THAT(received, ::testing::ElementsAre(0, 100));
+}
+
+TEST(EventTests, throttleSubscribersWithTrailingEdge) {
+    event<int> e;
+    std::mutex mtx;
+    std::vector<std::pair<int, std::chrono::steady_clock::time_point>> received;
+    delivery_policy throttle;
+    throttle.minInterval = std::chrono::milliseconds(50);
+    e.subscribe(
+        [&](int i) {
+            std::lock_guard<std::mutex> lock(mtx);
+            received.emplace_back(i, std::chrono::steady_clock::now());
+        },
+        throttle);
+
+    e.emit(0);
+    ASSERT_TRUE(waitFor([&]() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return received.size() == 1;
+    }));
+    for (int i = 1; i < 100; i++) {
+        e.emit(i);
+    }
+
+    ASSERT_TRUE(waitFor([&]() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return received.size() == 2;
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::lock_guard<std::mutex> lock(mtx);
+    ASSERT_EQ(received.size(), 2);
+    ASSERT_EQ(received[0].first, 0);
+    ASSERT_EQ(received[1].first, 99);
+    ASSERT_GE(received[1].second - received[0].second, std::chrono::milliseconds(45));
+}
+
+TEST(EventTests, dropThrottledEmitsWithoutTrailingEdge) {
+    event<int> e;
+    std::atomic<int> count(0);
+    std::atomic<int> last(-1);
+    delivery_policy throttle;
+    throttle.minInterval = std::chrono::milliseconds(200);
+    throttle.trailingEdge = false;
+    e.subscribe(
+        [&](int i) {
+            count++;
+            last = i;
+        },
+        throttle);
+
+    e.emit(0);
+    ASSERT_TRUE(waitFor([&count]() { return count == 1; }));
+    for (int i = 1; i < 100; i++) {
+        e.emit(i);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(last, 0);
+
+    delivery_policy negative;
+    negative.minInterval = std::chrono::milliseconds(-1);
+    ASSERT_THROW(e.subscribe([](int) {}, negative), std::invalid_argument);
+}
+
+namespace {
+
+// Subscribes a callback that blocks on its first emit until released
+struct BlockingSubscriber {
+    std::mutex mtx;
+    std::vector<int> received;
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+
+    void subscribe(event<int>& e, const delivery_policy& delivery) {
+        e.subscribe(
+            [this](int i) {
+                started = true;
+                while (!release) {
+                    std::this_thread::yield();
+                }
+                std::lock_guard<std::mutex> lock(mtx);
+                received.push_back(i);
+            },
+            delivery);
+    }
+
+    std::vector<int> waitForCount(size_t count) {
+        waitFor([this, count]() {
+            std::lock_guard<std::mutex> lock(mtx);
+            return received.size() >= count;
+        });
+        std::lock_guard<std::mutex> lock(mtx);
+        return received;
+    }
+};
+
+} // namespace
+
+TEST(EventTests, dropOldestEmitsWhenMailboxIsFull) {
+    event<int> e;
+    BlockingSubscriber subscriber;
+    delivery_policy bounded;
+    bounded.mailboxCapacity = 4;
+    bounded.overflow = overflow_policy::drop_oldest;
+    subscriber.subscribe(e, bounded);
+
+    e.emit(0);
+    ASSERT_TRUE(waitFor([&subscriber]() { return subscriber.started.load(); }));
+    for (int i = 1; i <= 10; i++) {
+        e.emit(i);
+    }
+    ASSERT_EQ(e.dropped(), 6);
+
+    subscriber.release = true;
+    ASSERT_THAT(subscriber.waitForCount(5), ::testing::ElementsAre(0, 7, 8, 9, 10));
+}
+
+TEST(EventTests, dropNewestEmitsWhenMailboxIsFull) {
+    event<int> e;
+    BlockingSubscriber subscriber;
+    delivery_policy bounded;
+    bounded.mailboxCapacity = 4;
+    bounded.overflow = overflow_policy::drop_newest;
+    subscriber.subscribe(e, bounded);
+
+    e.emit(0);
+    ASSERT_TRUE(waitFor([&subscriber]() { return subscriber.started.load(); }));
+    for (int i = 1; i <= 10; i++) {
+        e.emit(i);
+    }
+    ASSERT_EQ(e.dropped(), 6);
+
+    subscriber.release = true;
+    ASSERT_THAT(subscriber.waitForCount(5), ::testing::ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(EventTests, blockEmitterWhenMailboxIsFull) {
+    event<int> e;
+    BlockingSubscriber subscriber;
+    delivery_policy bounded;
+    bounded.mailboxCapacity = 2;
+    bounded.overflow = overflow_policy::block;
+    subscriber.subscribe(e, bounded);
+
+    e.emit(0);
+    ASSERT_TRUE(waitFor([&subscriber]() { return subscriber.started.load(); }));
+    std::atomic<bool> emitted(false);
+    std::thread emitter([&e, &emitted]() {
+        for (int i = 1; i <= 5; i++) {
+            e.emit(i);
+        }
+        emitted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(emitted);
+
+    subscriber.release = true;
+    emitter.join();
+    ASSERT_THAT(subscriber.waitForCount(6), ::testing::ElementsAre(0, 1, 2, 3, 4, 5));
+    ASSERT_EQ(e.dropped(), 0);
+}
+
+TEST(EventTests, dropInsteadOfBlockingWhenEmittingFromTheDispatchPool) {
+    event<int> source;
+    event<int> chained;
+    BlockingSubscriber subscriber;
+    delivery_policy bounded;
+    bounded.mailboxCapacity = 2;
+    bounded.overflow = overflow_policy::block;
+    subscriber.subscribe(chained, bounded);
+
+    // Blocking the single pool thread would keep it from ever draining the mailbox
+    std::atomic<bool> forwarded(false);
+    source.subscribe(
+        [&chained, &forwarded](int count) {
+            for (int i = 0; i < count; i++) {
+                chained.emit(i);
+            }
+            forwarded = true;
+        },
+        event_policy::asynchronous);
+
+    source.emit(10);
+    ASSERT_TRUE(waitFor([&forwarded]() { return forwarded.load(); }));
+    ASSERT_EQ(chained.dropped(), 8);
+
+    subscriber.release = true;
+    ASSERT_THAT(subscriber.waitForCount(2), ::testing::ElementsAre(0, 1));
+}
@@ -0,0 +1,104 @@
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/events/static_event.hpp>
+
+using namespace urf::common::events;
+
+namespace {
+
+int freeFunctionSum = 0;
+
+void addToFreeFunctionSum(const int& i) {
+    freeFunctionSum += i;
+}
+
+struct Accumulator {
+    int sum = 0;
+
+    void add(const int& i) { sum += i; }
+    void addTwice(const int& i) { sum += 2 * i; }
+};
+
+} // namespace
+
+TEST(StaticEventShould, invokeDelegatesInSubscriptionOrder) {
+    static_event<4, int> e;
+    Accumulator accumulator;
+    std::vector<int> order;
+    auto recordOrder = [&order](const int& i) { order.push_back(i); };
+
+    freeFunctionSum = 0;
+    ASSERT_TRUE(e.subscribe(delegate<int>::fromFunction<&addToFreeFunctionSum>()));
+    ASSERT_TRUE(e.subscribe(delegate<int>::fromMethod<&Accumulator::add>(&accumulator)));
+    ASSERT_TRUE(e.subscribe(delegate<int>::fromCallable(&recordOrder)));
+    ASSERT_EQ(e.size(), 3);
+
+    e.emit(5);
+    e.emit(7);
+    ASSERT_EQ(freeFunctionSum, 12);
+    ASSERT_EQ(accumulator.sum, 12);
+    ASSERT_THAT(order, ::testing::ElementsAre(5, 7));
+}
+
+TEST(StaticEventShould, refuseSubscribersOverCapacity) {
+    unsynchronized_static_event<2, int> e;
+    Accumulator first;
+    Accumulator second;
+    Accumulator third;
+
+    ASSERT_FALSE(e);
+    ASSERT_TRUE(e.subscribe(delegate<int>::fromMethod<&Accumulator::add>(&first)));
+    ASSERT_TRUE(e.subscribe(delegate<int>::fromMethod<&Accumulator::add>(&second)));
+    ASSERT_FALSE(e.subscribe(delegate<int>::fromMethod<&Accumulator::add>(&third)));
+    ASSERT_FALSE(e.subscribe(delegate<int>()));
+    ASSERT_TRUE(e);
+    ASSERT_EQ(e.capacity(), 2);
+
+    e.emit(1);
+    ASSERT_EQ(first.sum, 1);
+    ASSERT_EQ(second.sum, 1);
+    ASSERT_EQ(third.sum, 0);
+}
+
+TEST(StaticEventShould, unsubscribeDelegates) {
+    unsynchronized_static_event<4, int> e;
+    Accumulator accumulator;
+    auto add = delegate<int>::fromMethod<&Accumulator::add>(&accumulator);
+    auto addTwice = delegate<int>::fromMethod<&Accumulator::addTwice>(&accumulator);
+    ASSERT_NE(add, addTwice);
+
+    e.subscribe(add);
+    e.subscribe(addTwice);
+    ASSERT_TRUE(e.unsubscribe(add));
+    ASSERT_FALSE(e.unsubscribe(add));
+    ASSERT_EQ(e.size(), 1);
+
+    e.emit(1);
+    ASSERT_EQ(accumulator.sum, 2);
+}
+
+TEST(StaticEventShould, allowReentrantCallbacks) {
+    static_event<4, int> e;
+    std::vector<int> received;
+    delegate<int> self;
+    auto callback = [&e, &received, &self](int i) {
+        received.push_back(i);
+        if (i > 0) {
+            e.emit(i - 1);
+        } else {
+            e.unsubscribe(self);
+        }
+    };
+    self = delegate<int>::fromCallable(&callback);
+    ASSERT_TRUE(e.subscribe(self));
+
+    // Would deadlock if the mutex was held while the delegates run
+    e.emit(2);
+    ASSERT_THAT(received, ::testing::ElementsAre(2, 1, 0));
+    ASSERT_FALSE(e);
+    e.emit(5);
+    ASSERT_EQ(received.size(), 3);
+}
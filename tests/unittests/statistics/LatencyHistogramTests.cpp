@@ -0,0 +1,49 @@
+#include <chrono>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <urf/common/statistics/LatencyHistogram.hpp>
+
+using urf::common::statistics::LatencyHistogram;
+
+TEST(LatencyHistogramShould, recordInPowerOfTwoBuckets) {
+    LatencyHistogram histogram;
+    histogram.record(std::chrono::nanoseconds(500));
+    histogram.record(std::chrono::microseconds(1));
+    histogram.record(std::chrono::microseconds(3));
+    histogram.record(std::chrono::microseconds(3));
+
+    ASSERT_EQ(histogram.count(), 4);
+    ASSERT_EQ(histogram.buckets()[0], 1);
+    ASSERT_EQ(histogram.buckets()[1], 1);
+    ASSERT_EQ(histogram.buckets()[2], 2);
+    ASSERT_EQ(histogram.min(), std::chrono::nanoseconds(500));
+    ASSERT_EQ(histogram.max(), std::chrono::microseconds(3));
+}
+
+TEST(LatencyHistogramShould, computePercentiles) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 99; i++) {
+        histogram.record(std::chrono::microseconds(10));
+    }
+    histogram.record(std::chrono::milliseconds(10));
+
+    ASSERT_EQ(histogram.percentile(50), std::chrono::microseconds(16));
+    ASSERT_EQ(histogram.percentile(100), std::chrono::milliseconds(10));
+}
+
+TEST(LatencyHistogramShould, mergeAndReset) {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.record(std::chrono::microseconds(2));
+    second.record(std::chrono::microseconds(4));
+    first.merge(second);
+
+    ASSERT_EQ(first.count(), 2);
+    ASSERT_EQ(first.mean(), std::chrono::microseconds(3));
+
+    first.reset();
+    ASSERT_EQ(first.count(), 0);
+    ASSERT_EQ(first.mean(), std::chrono::nanoseconds(0));
+}
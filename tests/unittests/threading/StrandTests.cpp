@@ -0,0 +1,85 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "urf/common/threading/Strand.hpp"
+#include "urf/common/threading/ThreadPool.hpp"
+
+using namespace urf::common::threading;
+
+TEST(StrandShould, runTasksInPostOrder) {
+    ThreadPool pool(4);
+    Strand strand(pool);
+
+    std::vector<int> executed;
+    std::atomic<int> running(0);
+    std::atomic<bool> overlapped(false);
+    for (int i = 0; i < 1000; i++) {
+        strand.post([i, &executed, &running, &overlapped]() {
+            if (running++ != 0) {
+                overlapped = true;
+            }
+            executed.push_back(i);
+            running--;
+        });
+    }
+
+    pool.waitForTasks();
+    ASSERT_EQ(strand.pending(), 0);
+    ASSERT_FALSE(overlapped);
+    ASSERT_EQ(executed.size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(executed[i], i);
+    }
+}
+
+TEST(StrandShould, runDifferentStrandsInParallel) {
+    ThreadPool pool(2);
+    Strand first(pool);
+    Strand second(pool);
+
+    std::atomic<int> inside(0);
+    std::atomic<int> overlapped(0);
+    auto task = [&inside, &overlapped]() {
+        inside++;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while ((inside < 2) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::yield();
+        }
+        if (inside == 2) {
+            overlapped++;
+        }
+    };
+
+    first.post(task);
+    second.post(task);
+    pool.waitForTasks();
+    ASSERT_EQ(overlapped, 2);
+}
+
+TEST(StrandShould, notStarveOtherTasksOfASingleThreadPool) {
+    ThreadPool pool(1);
+    Strand busy(pool);
+
+    std::atomic<bool> otherRan(false);
+    std::atomic<int> busyRunsBeforeOther(0);
+    std::function<void()> repost;
+    repost = [&busy, &repost, &otherRan, &busyRunsBeforeOther]() {
+        if (otherRan) {
+            return;
+        }
+        busyRunsBeforeOther++;
+        busy.post(repost);
+    };
+
+    busy.post(repost);
+    pool.pushTask([&otherRan]() { otherRan = true; });
+    pool.waitForTasks();
+    ASSERT_TRUE(otherRan);
+    ASSERT_LT(busyRunsBeforeOther, 10);
+}
@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -32,4 +34,27 @@ TEST(ThreadPoolShould, executeStdFunction) {
     pool.pushTask(f, 1, 1);
     pool.waitForTasks();
     ASSERT_EQ(result, 2);
+}
+
+TEST(ThreadPoolShould, resetThreadCount) {
+    ThreadPool pool(1);
+    ASSERT_EQ(pool.getThreadCount(), 1);
+
+    std::atomic<int> executed(0);
+    pool.pushTask([&executed]() { executed++; });
+    pool.reset(3);
+    ASSERT_EQ(pool.getThreadCount(), 3);
+    ASSERT_EQ(executed, 1);
+
+    auto result = pool.submit([]() { return 42; });
+    ASSERT_EQ(result.get(), 42);
+}
+
+TEST(ThreadPoolShould, recognizeItsWorkerThreads) {
+    ThreadPool pool(2);
+    ThreadPool other(1);
+    ASSERT_FALSE(pool.isWorkerThread());
+
+    ASSERT_TRUE(pool.submit([&pool]() { return pool.isWorkerThread(); }).get());
+    ASSERT_FALSE(pool.submit([&other]() { return other.isWorkerThread(); }).get());
 }
\ No newline at end of file